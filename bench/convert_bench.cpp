@@ -0,0 +1,199 @@
+// This file is part of The New Aspell
+// Copyright (C) 2011 by Kevin Atkinson under the GNU LGPL license
+// version 2.0 or 2.1.  You should have received a copy of the LGPL
+// license along with this library if you did not you can find
+// it at http://www.gnu.org/.
+
+// Micro-benchmark for the UTF-8 decoder and encoder.  Times the
+// scalar code against each vectorized version the cpu supports on
+// a few synthetic texts, both when converting a line at a time (as
+// the checker does) and in large blocks, and checks that every
+// version gives the same result.
+//
+// usage: convert-bench [<size in KB> [<repetitions>]]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "config.hpp"
+#include "convert.hpp"
+#include "stack_ptr.hpp"
+#include "utf8_simd.hpp"
+
+using namespace aspell;
+
+static const char * ascii_words[] = {
+  "the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog",
+  "spelling", "checker", "dictionary", "suggestion", "of", "and",
+  "a", "to", "in", "is", "that", "it", "was", "for", "on", "are", 0
+};
+
+static const char * latin_words[] = {
+  "the", "caf\xc3\xa9", "na\xc3\xafve", "fa\xc3\xa7" "ade", "stra\xc3\x9f" "e",
+  "und", "der", "die", "das", "\xc3\xbc" "ber", "sch\xc3\xb6n", "m\xc3\xa4" "dchen",
+  "el", "ni\xc3\xb1o", "a\xc3\xb1o", "se\xc3\xb1or", "word", "check", 0
+};
+
+static const char * cjk_words[] = {
+  "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e", "\xe4\xb8\xad\xe6\x96\x87",
+  "\xed\x95\x9c\xea\xb5\xad\xec\x96\xb4", "\xe3\x81\x8b\xe3\x81\xaa",
+  "aspell", 0
+};
+
+struct Corpus {
+  const char * name;
+  const char * * words;
+};
+
+static const Corpus corpora[] = {
+  {"ascii", ascii_words},
+  {"latin", latin_words},
+  {"cjk",   cjk_words},
+  {0, 0}
+};
+
+// builds size bytes of text out of words, with lines of about 70
+// bytes
+static void make_text(const char * * words, size_t size, String & text)
+{
+  unsigned num_words = 0;
+  while (words[num_words]) ++num_words;
+  unsigned seed = 1;
+  size_t line_len = 0;
+  text.clear();
+  while (text.size() < size) {
+    seed = seed * 1103515245 + 12345;
+    const char * w = words[(seed >> 16) % num_words];
+    text.append(w);
+    line_len += strlen(w);
+    if (line_len > 70) {text.append('\n'); line_len = 0;}
+    else {text.append(' '); ++line_len;}
+  }
+}
+
+static void split_lines(const String & text, Vector<String> & lines)
+{
+  const char * p = text.str();
+  const char * end = p + text.size();
+  while (p != end) {
+    const char * e = (const char *)memchr(p, '\n', end - p);
+    e = e ? e + 1 : end;
+    lines.push_back(String(p, e - p));
+    p = e;
+  }
+}
+
+struct Result {
+  double decode_secs;
+  double encode_secs;
+  unsigned long checksum;
+};
+
+static unsigned long checksum(const CharVector & out, unsigned long sum)
+{
+  for (const char * i = out.pbegin(); i != out.pend(); ++i)
+    sum = sum * 31 + (unsigned char)*i;
+  return sum;
+}
+
+static Result run(const Decode * decode, const Encode * encode,
+                  const Vector<String> & chunks, unsigned reps)
+{
+  Result res;
+  FilterCharVector buf;
+  CharVector out;
+  res.decode_secs = 0;
+  res.encode_secs = 0;
+
+  clock_t start;
+  for (unsigned r = 0; r != reps; ++r) {
+    start = clock();
+    for (unsigned i = 0; i != chunks.size(); ++i) {
+      buf.clear();
+      decode->decode(chunks[i].str(), chunks[i].size(), buf);
+    }
+    res.decode_secs += (clock() - start)/(double)CLOCKS_PER_SEC;
+  }
+
+  Vector<FilterCharVector> decoded(chunks.size());
+  for (unsigned i = 0; i != chunks.size(); ++i)
+    decode->decode(chunks[i].str(), chunks[i].size(), decoded[i]);
+  for (unsigned r = 0; r != reps; ++r) {
+    start = clock();
+    for (unsigned i = 0; i != chunks.size(); ++i) {
+      out.clear();
+      encode->encode(decoded[i].pbegin(), decoded[i].pbegin() + decoded[i].size(), out);
+    }
+    res.encode_secs += (clock() - start)/(double)CLOCKS_PER_SEC;
+  }
+
+  res.checksum = 0;
+  for (unsigned i = 0; i != chunks.size(); ++i) {
+    for (unsigned j = 0; j != decoded[i].size(); ++j)
+      res.checksum = res.checksum * 31 + decoded[i][j].chr * 7 + decoded[i][j].width;
+    out.clear();
+    encode->encode(decoded[i].pbegin(), decoded[i].pbegin() + decoded[i].size(), out);
+    res.checksum = checksum(out, res.checksum);
+  }
+  return res;
+}
+
+int main(int argc, const char * argv[])
+{
+  size_t size = 1024 * (argc > 1 ? atoi(argv[1]) : 4096);
+  unsigned reps = argc > 2 ? atoi(argv[2]) : 5;
+
+  StackPtr<Config> config(new_basic_config());
+  PosibErr<Decode *> d = Decode::get_new("utf-8", config.get());
+  PosibErr<Encode *> e = Encode::get_new("utf-8", config.get());
+  if (d.has_err() || e.has_err()) {
+    fprintf(stderr, "Unable to create the UTF-8 converters.\n");
+    return 1;
+  }
+  StackPtr<Decode> decode(d.data);
+  StackPtr<Encode> encode(e.data);
+
+  static const struct {Utf8SimdLevel level; const char * name;} impls[] = {
+    {Utf8SimdNone, "scalar"},
+    {Utf8SimdSse2, "sse2"},
+    {Utf8SimdAvx2, "avx2"}
+  };
+
+  printf("%-6s %-6s %-7s %12s %12s\n",
+         "text", "chunks", "impl", "decode MB/s", "encode MB/s");
+  bool ok = true;
+  for (const Corpus * c = corpora; c->name; ++c) {
+    String text;
+    make_text(c->words, size, text);
+    Vector<String> lines, blocks;
+    split_lines(text, lines);
+    for (unsigned i = 0; i != lines.size(); ++i) {
+      if (blocks.empty() || blocks.back().size() >= 65536)
+        blocks.push_back(String());
+      blocks.back() += lines[i];
+    }
+    for (int j = 0; j != 2; ++j) {
+      const Vector<String> & chunks = j == 0 ? lines : blocks;
+      unsigned long expected = 0;
+      for (unsigned k = 0; k != sizeof(impls)/sizeof(impls[0]); ++k) {
+        if (!set_utf8_simd(impls[k].level)) continue;
+        Result res = run(decode.get(), encode.get(), chunks, reps);
+        double mb = text.size() * (double)reps / (1024 * 1024);
+        printf("%-6s %-6s %-7s %12.1f %12.1f\n",
+               c->name, j == 0 ? "line" : "block", impls[k].name,
+               mb / res.decode_secs, mb / res.encode_secs);
+        if (k == 0) {
+          expected = res.checksum;
+        } else if (res.checksum != expected) {
+          printf("  ERROR: %s output differs from the scalar version\n",
+                 impls[k].name);
+          ok = false;
+        }
+      }
+    }
+  }
+  set_utf8_simd(Utf8SimdBest);
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,3000 @@
+babakt/C
+babo/AM
+babolu/A
+babotung/C
+babugo/A
+bada/A
+badamr/C
+baga/A
+bagarg/C
+bagavogg/CL
+bagonobb/CL
+bagov/B
+bagumm/C
+bako/A
+bakolo/A
+bakuz/B
+balog/BL
+balum/B
+balusb/C
+bama/A
+bamosk/CL
+bamuvg/CL
+banabg/CL
+banabu/A
+banarub/B
+banuzavb/C
+barolovg/C
+baru/A
+basagn/C
+basot/B
+basu/A
+basuladm/C
+basuro/AL
+bata/A
+bato/A
+batodv/C
+batogv/C
+batun/BL
+batunals/CL
+bavarn/C
+bavasr/C
+bavubol/B
+bazan/BM
+bazu/A
+bazudz/C
+bazuvr/CL
+bebelg/CL
+bebess/CL
+bebi/AL
+bebige/A
+bebil/BL
+bebirib/B
+bede/A
+bedeb/B
+bedeke/AM
+bedeni/A
+bedenm/C
+bederid/B
+bederr/C
+bedi/AL
+bedibend/CL
+bedigl/C
+bedik/B
+bedisr/CL
+begetn/C
+begezd/C
+begi/A
+begiz/B
+bekege/AL
+bekesm/C
+bekesv/CM
+beki/A
+bekiv/BL
+beled/BL
+belekb/CM
+belekd/C
+belemitk/C
+belere/A
+beligk/C
+belizd/C
+beme/A
+bemezg/C
+bemizilr/C
+beneb/B
+beni/AL
+berit/BM
+beseretn/CL
+besesi/AL
+beset/B
+besezi/A
+besi/AL
+besivd/C
+bete/A
+betek/BM
+betett/CL
+beti/A
+betide/A
+betiti/AL
+bevez/B
+bezedz/CL
+bezegell/C
+bezekl/C
+bezelid/B
+bezen/B
+bezibel/B
+bezidi/AM
+bezinibk/C
+biberiz/BL
+bibetm/C
+bibige/AM
+bidebil/BL
+bidek/B
+bidekidz/C
+biderg/C
+bides/B
+bidezg/C
+bidims/CL
+biditt/C
+bidiz/B
+bigebe/AM
+bigigekn/C
+bigik/B
+bigike/AL
+bigitelk/C
+bigives/BL
+bikeg/BM
+biki/A
+bikidi/A
+bile/A
+biled/BL
+bili/AL
+bilitiv/B
+bime/A
+bimeb/BL
+bimi/A
+bimil/B
+binelemg/C
+binesi/A
+bini/AL
+binigd/C
+biniser/B
+binisk/C
+binivg/CL
+bire/A
+biredill/C
+birel/B
+biride/A
+birigs/CM
+birit/B
+birize/A
+bisedb/C
+bisegm/CL
+biseri/A
+bises/B
+bisi/A
+bisimg/C
+bite/AL
+biter/BL
+bive/A
+bivelt/CL
+bivenk/C
+bivesev/B
+bivide/AM
+bivivd/CM
+bivivid/BM
+bize/A
+bizeg/B
+bizek/BL
+bizer/B
+bizest/C
+bizibg/CM
+bizidenm/C
+bizili/A
+bizivivm/C
+bobobk/C
+bodatok/BL
+bodov/BM
+bodumom/BM
+bodutoz/B
+bogog/B
+bogolug/BM
+bogos/B
+bogozu/A
+bogu/A
+bokokt/C
+bokom/B
+bokumo/A
+bomakn/C
+bomalul/BM
+bomazo/A
+bomo/A
+bomobosv/C
+bomomk/CL
+bomudo/AM
+bomutodd/C
+bonalal/B
+bonam/B
+borasu/A
+boraz/B
+borazo/A
+boro/A
+borond/C
+boruv/B
+bosa/A
+bosab/B
+bosalg/C
+bosutamt/C
+botog/B
+botut/BM
+botuta/A
+bovadm/CM
+bovatn/C
+bovo/AM
+bovuso/A
+boza/AM
+bozonl/C
+bozorg/CL
+buba/A
+bubadot/B
+bubas/B
+bubudulg/C
+bubutz/C
+buda/A
+budat/BL
+budokk/C
+budomotz/CL
+budukovr/C
+budulr/CL
+bugabs/C
+bugavo/A
+bugo/A
+bugotok/B
+bugov/BL
+bugub/B
+bugukr/C
+bugul/B
+bugulu/A
+bukagb/C
+bukud/BM
+bukur/B
+bularb/C
+bumakan/B
+bumo/A
+bumot/B
+bumu/A
+buna/A
+bunavz/C
+bunot/B
+bunub/BM
+bunul/B
+bunura/A
+buro/A
+buru/A
+busaba/AM
+busak/B
+busamt/C
+buso/A
+busobs/CM
+busovd/C
+butav/B
+bututk/C
+buvatok/B
+buvavt/C
+buvob/B
+buzag/B
+buzat/BM
+buzovk/C
+buzum/B
+dabo/AM
+dabokb/C
+dabu/AM
+dada/A
+dador/B
+dagatams/C
+dagazd/CM
+dagotumb/C
+dagur/B
+daku/A
+dakug/BL
+dakuko/AL
+dalot/B
+damol/B
+danagoln/C
+danakab/B
+dano/AM
+danodt/C
+danoro/A
+daradam/B
+darodb/C
+darubol/B
+darukab/B
+darukg/CL
+darulz/C
+dasako/A
+dasalo/A
+data/A
+datag/BL
+datals/C
+datugat/B
+davalo/A
+davokn/C
+davovu/AL
+davuka/AL
+davuva/A
+dazazakr/C
+dazugog/B
+debe/AM
+debeb/B
+debekid/B
+debil/BL
+debivz/CL
+dedemem/B
+deden/B
+dedes/BL
+dedi/A
+degegr/C
+deges/B
+degetv/C
+degi/A
+degig/B
+degises/B
+dekebeg/B
+dekede/A
+dekedi/A
+dekege/A
+dekeril/B
+dekezi/A
+deli/A
+deme/A
+demes/B
+demetimm/C
+demit/BL
+demiziln/C
+dene/A
+deneds/CL
+denerev/B
+deni/A
+denirm/C
+derend/C
+derez/B
+deri/A
+deriket/B
+derilt/CL
+dese/A
+desivi/A
+desiz/B
+desizi/A
+detedi/A
+detiki/A
+detimi/A
+deve/A
+devez/B
+devisis/BM
+devit/B
+dezezi/A
+dibe/AL
+dibed/B
+diber/BM
+dibi/A
+dibizeks/C
+didedek/B
+didenm/CM
+dider/B
+didet/B
+didi/A
+dige/A
+digeletr/CL
+digi/A
+digikit/B
+digimer/B
+digis/B
+digitb/C
+digivek/B
+dikedl/C
+dikemi/A
+dikes/B
+dikev/B
+dikike/AL
+dikimi/A
+dikin/BL
+dikitidt/CM
+dikiv/B
+dikizedz/C
+dile/A
+dilegem/B
+dili/A
+dilig/B
+dilitil/B
+dimed/B
+dimelibg/C
+dimenm/C
+dimideb/BM
+dimin/B
+dine/AL
+dinedesm/C
+dinetek/B
+dinibi/AL
+dire/AL
+diredi/A
+diregs/CL
+direni/A
+direr/B
+diretemv/C
+diribe/AM
+diride/A
+dirimi/A
+dirini/A
+dirive/A
+disegm/CM
+disike/A
+disile/A
+disitits/C
+ditemv/C
+ditener/BM
+diterb/CL
+ditezs/C
+diti/A
+ditilz/CL
+divenebk/C
+dives/B
+divi/A
+dize/AL
+dizel/BM
+dizere/A
+dizi/A
+dizikl/C
+dobalakn/C
+doband/C
+dobo/A
+dobu/A
+dobuds/C
+doda/AL
+dogadk/CM
+dogasavs/CM
+dogo/AL
+dogulz/C
+doguvr/CM
+dokabr/CL
+dokalud/BL
+dokavu/AL
+doko/AL
+dokokr/C
+dokolg/C
+dokott/CL
+dolako/A
+dolamoz/B
+dologusz/CL
+doloval/B
+dolozn/CL
+dolu/A
+dolutt/C
+doluv/B
+domavazz/C
+domudut/BM
+dononl/C
+dorasl/C
+doru/AM
+dorulg/C
+doruzk/C
+dosodubs/CL
+dosot/BM
+dosukas/BM
+dota/AL
+doto/A
+dotulabk/C
+dotumv/C
+dovagovs/C
+dovarz/C
+dovubl/C
+dozanuzr/CL
+dozugm/CM
+dubad/B
+duban/BL
+dubogn/CL
+duboz/BL
+duda/A
+dudom/B
+dudulak/B
+dudum/B
+dudunz/CL
+dugabu/AL
+dugogr/C
+dugu/A
+dugurg/C
+duguvl/C
+dukol/B
+dukotab/BM
+duku/AM
+dukukub/B
+dulas/B
+dulum/B
+dulurav/B
+dumabobd/C
+dumon/B
+dunag/B
+dunus/B
+dura/A
+durakk/CL
+durata/A
+durokz/C
+durom/B
+duru/A
+dururt/CL
+dusatusd/CM
+dusogug/B
+dusu/AL
+dutomut/B
+dutoval/B
+dutu/A
+dutuls/C
+duvo/AM
+duvosa/A
+duzazl/C
+duzo/A
+duzomo/A
+duzu/AM
+duzuba/A
+duzunuvn/CL
+gabam/B
+gabur/BM
+gadasv/C
+gadazuzb/C
+gaganm/C
+gagatabm/C
+gago/AL
+gakat/BM
+gakogomz/C
+gakozol/B
+gakuku/A
+gakurudz/CL
+gakuvm/C
+galadk/C
+galakal/BL
+gamalo/A
+gaman/BM
+gamanz/C
+gamud/B
+gamuvolk/CL
+gano/A
+ganobamm/C
+gara/AL
+garog/B
+garokog/B
+garugo/A
+gasa/A
+gasamb/CM
+gasazum/BL
+gasuk/B
+gatokt/C
+gatozo/AM
+gatuma/AL
+gavazosk/C
+gavokots/CL
+gavozot/B
+gavud/B
+gavulr/C
+gavuzukn/C
+gazagk/C
+gazo/A
+gazos/B
+gazugusg/C
+gazul/B
+gebedegm/C
+gebedr/C
+gebelg/CL
+gebem/B
+gebi/AM
+gedemebt/C
+gederv/C
+gedes/B
+gedig/BM
+gedil/B
+gedilg/C
+gedisi/A
+gege/A
+gegeg/B
+gegen/BL
+gegi/AL
+gegiz/B
+geke/A
+geked/BL
+gekel/B
+gekerz/CL
+geki/A
+gekidekm/C
+gekisi/A
+gelevin/B
+gelez/B
+geli/A
+gelikl/C
+gelir/B
+gelirg/C
+gelisi/A
+gemed/BL
+gemeli/AM
+gememm/CL
+gemez/B
+gemigr/C
+gemile/A
+gemililv/CL
+gemiliv/B
+genilelt/C
+genirb/CL
+genisin/BL
+geseri/A
+gesevr/CM
+gesidz/C
+gesil/BM
+gete/A
+getidid/BM
+getidz/CL
+getir/BL
+geverz/CL
+gevete/AL
+gevev/B
+gevevelm/CM
+gevi/A
+gevig/B
+geze/A
+gezegitv/C
+gezes/B
+gezi/AM
+gezidem/BM
+gezikd/C
+gezini/A
+gezinr/C
+gezizig/B
+gibemt/C
+gibi/AM
+gibiked/BL
+gibilib/B
+gibill/C
+gibiv/B
+gideb/B
+gidenn/C
+gidevs/CM
+gidig/BL
+gidilil/B
+gige/A
+gigin/B
+gike/A
+gikerin/B
+gikesz/C
+gikev/BL
+gikike/A
+gikikt/CL
+gikire/A
+gikizi/A
+gilesg/C
+gili/AM
+gilite/A
+gilizi/AL
+gimegn/C
+gimer/BL
+gimigetl/C
+gine/AL
+ginelk/C
+gineni/A
+gini/A
+ginik/BL
+giremerd/C
+giri/A
+girir/B
+girirezk/C
+girit/B
+gise/A
+giseki/A
+gisi/A
+gisis/B
+gisisv/C
+gite/A
+gitebb/C
+gitebedm/C
+gitev/B
+gitigevn/CM
+gititikn/C
+gitiv/B
+gived/BL
+givekirl/C
+givi/A
+givibid/B
+givim/B
+givire/A
+gizelb/C
+gizesl/CM
+gizi/A
+gizin/B
+goba/A
+gobazo/AM
+gobu/A
+gobubz/C
+godal/BM
+godoz/B
+godozm/CL
+goga/A
+goka/AL
+gokanoz/B
+gokatorl/C
+gokoko/AL
+gokotu/AL
+gola/A
+golalo/A
+golu/A
+gomov/BL
+gomuva/AM
+gomuvn/CM
+gona/A
+gonasals/C
+gonavuvz/C
+gonu/A
+gorago/A
+goro/A
+goru/A
+gosa/A
+gosak/B
+gosala/A
+gosu/AL
+gotos/B
+gotovat/B
+govul/B
+govurk/C
+gozalv/C
+gozarv/C
+gozob/B
+gozubt/C
+guba/AL
+gubakr/CL
+gubatl/CL
+gudadv/C
+gudamg/C
+gudus/B
+guduv/B
+gugo/A
+gugogo/A
+gugub/B
+gukans/C
+guko/A
+guku/A
+gukuromr/C
+gulaludb/C
+gulamz/C
+gulo/A
+gulobu/AM
+gulumd/CM
+gumorg/CM
+guno/A
+gunu/A
+gurar/B
+guro/AM
+guron/B
+gurugz/C
+guso/AL
+gusot/B
+gusum/B
+guta/AL
+guto/A
+gutodabt/C
+gutong/C
+gutusov/B
+guvo/A
+guvoml/C
+guvu/A
+guvuru/A
+guvuv/B
+guvuzan/B
+kabalz/C
+kabo/A
+kabodb/C
+kabult/C
+kadon/B
+kaduk/B
+kadum/BL
+kadusn/C
+kagu/A
+kaku/A
+kakuka/A
+kalazulv/C
+kamona/A
+kano/A
+kanun/BM
+kanuzuv/B
+karakog/B
+karanr/CM
+karol/B
+karorovl/C
+kasu/A
+kasubud/B
+katagoz/BL
+katokab/B
+kavab/BL
+kavabm/C
+kavokons/C
+kavudumk/C
+kavumt/C
+kavuzan/BM
+kazadn/C
+kazokobd/C
+kazuka/AM
+kazuv/BL
+kebetiv/B
+kebin/B
+kebit/B
+kedek/B
+kedemi/A
+kedi/AL
+kedilk/CL
+kedinesl/CL
+kegegigd/CL
+kegezk/C
+kegi/A
+kegilenb/C
+kegir/B
+kekeb/B
+kekekg/C
+kekel/B
+keki/A
+kekidb/C
+kekivi/AM
+kelegs/C
+keligz/C
+kelizegk/C
+kemi/AL
+kemigg/CL
+kemikt/C
+kenerr/C
+kenevimn/C
+keni/AM
+kenisi/AL
+kenivk/C
+kere/AM
+keredm/CL
+kerer/BL
+keri/AL
+kerige/A
+kerigl/CL
+kerisi/A
+kesedd/C
+kete/A
+keted/BM
+keteriml/C
+ketezirn/C
+keti/A
+ketir/B
+ketit/BL
+keve/AL
+kevese/A
+kevesisv/C
+kevezir/B
+kevi/A
+kevib/BM
+kevim/BM
+keze/A
+kezi/AM
+kezig/B
+kibenk/C
+kiber/B
+kibev/BM
+kibez/B
+kibi/A
+kibil/BL
+kibin/B
+kibinimz/C
+kibitb/C
+kide/A
+kidebi/A
+kideme/A
+kidens/C
+kididigs/C
+kige/A
+kigevel/B
+kigevet/B
+kigi/A
+kigign/C
+kigimezg/C
+kigimird/C
+kigizz/C
+kike/A
+kikege/A
+kikegin/BL
+kikitint/CM
+kikiv/B
+kilekeml/CL
+kilelk/C
+kilemin/BM
+kilerl/C
+kiletk/CL
+kilits/C
+kilizg/C
+kilizi/A
+kime/A
+kimemi/A
+kimese/A
+kimi/A
+kimikv/C
+kimilg/CL
+kine/A
+kini/A
+kiniri/A
+kinitims/C
+kire/A
+kired/B
+kireli/A
+kiri/AL
+kiritedb/C
+kiritibd/CM
+kise/A
+kisemi/A
+kisemim/B
+kiserek/B
+kisiken/B
+kisimemv/C
+kisiz/B
+kitediv/BM
+kiteli/A
+kiterem/B
+kitevelv/C
+kiti/AL
+kitig/BL
+kitik/B
+kitimim/B
+kitisv/C
+kiveb/BL
+kivegivn/C
+kivemi/A
+kivenz/C
+kivesen/B
+kividm/C
+kivit/B
+kiviz/B
+kize/A
+kizeb/B
+kizi/A
+kiziter/B
+kizizen/B
+kobag/B
+kobogavn/C
+kobok/BM
+kobor/BL
+kobubu/AL
+koburm/C
+kobutg/CL
+kodavo/A
+kogabr/CL
+koguvamn/C
+kokak/B
+kokat/B
+kokoba/A
+kokukav/BL
+kokumz/CM
+kola/A
+kolanark/CL
+kolasm/C
+kolukudg/CL
+komono/A
+kono/A
+konor/B
+konudul/B
+konukast/C
+konunl/C
+koradv/C
+korav/B
+korom/B
+korotm/C
+korukob/B
+kosata/AM
+kotodz/C
+kotu/A
+kova/AL
+kovanl/C
+kovaso/A
+kovor/B
+kovos/B
+kozaz/B
+kozo/AL
+kozus/B
+kuba/A
+kubokb/C
+kudoratr/C
+kudut/B
+kugu/A
+kukamk/C
+kukatu/A
+kukobm/CL
+kulabaz/B
+kumalg/C
+kumavn/C
+kumavon/B
+kumo/A
+kumu/A
+kunuto/A
+kura/A
+kuralatk/CL
+kurasv/C
+kurunu/A
+kuruv/BM
+kusadv/C
+kusas/B
+kusot/B
+kusovd/C
+kusu/AM
+kusudom/BL
+kusung/C
+kuta/A
+kuto/A
+kutorun/B
+kutuzd/CM
+kuvu/AM
+kuvudd/C
+kuzadk/C
+kuzan/B
+kuzota/A
+kuzurd/C
+labob/B
+laboz/B
+labusasl/C
+ladaduvs/C
+ladamatb/CM
+ladok/BM
+ladu/A
+laduvazm/C
+laga/A
+laganm/C
+lagom/B
+lakula/A
+lakuragb/C
+lalas/B
+lalo/A
+lalols/CL
+lalorb/C
+lamav/BL
+lamobm/C
+lamobo/A
+lamotu/AL
+lamumuvm/C
+lano/AL
+larogolk/C
+larolo/A
+larord/C
+larulr/C
+larusad/B
+lasos/BL
+lata/A
+latalulm/C
+lato/A
+latozal/B
+latu/A
+lavarus/BL
+lavosuz/B
+lavu/A
+lavuv/B
+laza/A
+lazamm/C
+lazom/B
+lebedt/C
+lebemn/C
+lebi/A
+lebidi/AL
+lebizetk/C
+lede/A
+ledel/BL
+ledev/BM
+lediv/B
+lege/A
+legi/A
+legid/B
+lekenr/C
+lekent/C
+leker/B
+lekers/CM
+lekesi/A
+lekest/C
+lekiditd/C
+lekisi/AM
+lekiv/B
+lelerinr/C
+lelevitg/C
+lelinivs/C
+leliz/B
+lemedn/C
+lemegl/CM
+lemers/C
+lemetiz/BM
+lemevr/C
+lemi/AM
+lenelels/C
+leni/A
+lenibv/C
+leniriz/BL
+lenis/BL
+lere/A
+leri/AL
+lerirl/C
+lese/AL
+leseb/B
+leses/B
+lesetb/C
+lesevel/B
+lesigem/B
+lesimizd/C
+lesin/B
+leted/B
+letene/AM
+letenev/BL
+letes/B
+letikz/C
+letimi/A
+letin/B
+letivb/C
+levisi/AL
+leviz/BM
+lezedg/CL
+lezetidn/C
+lezime/A
+libekk/C
+libelz/C
+libet/B
+libigd/C
+libiz/B
+libizin/BL
+lidebeg/B
+lidi/A
+lidin/BM
+lidint/C
+lige/AM
+liged/B
+ligedr/C
+ligegin/BM
+ligi/A
+ligineg/B
+ligini/A
+likezv/C
+lile/A
+liledisv/C
+lili/A
+lilidi/AL
+lilitn/C
+lilivi/A
+lime/A
+limegr/C
+limek/B
+limene/A
+limis/BL
+lineki/A
+lineriz/B
+linided/B
+linimed/BL
+lire/AM
+lirerv/C
+liri/AL
+lirib/B
+liridit/B
+lirit/B
+lirizil/B
+lise/A
+liserekg/C
+lisigen/B
+lisir/B
+lite/A
+litedi/AL
+litedv/C
+litekb/CL
+litizz/C
+livek/B
+livevitv/C
+livilk/C
+livinb/C
+livit/B
+livizit/B
+lize/A
+lizekils/C
+lizib/BL
+lizirr/C
+lobovamg/C
+lobu/A
+lobuzu/A
+loda/A
+lodo/A
+lodogod/BL
+lodozumv/C
+lodusur/BL
+loduzos/B
+logak/B
+logakogg/CM
+logokd/C
+logon/B
+logota/AM
+logub/BL
+logum/B
+logusag/B
+logusz/C
+lokaba/A
+lokalr/C
+lokogub/BL
+lokuk/B
+lolabumt/C
+lolas/B
+lolovas/BM
+loluvuzd/C
+loluvv/C
+loma/A
+lomal/B
+lomalumk/CL
+lomasu/A
+lomavodt/CL
+lomo/AL
+lomu/A
+lona/A
+lonarav/BM
+lono/A
+lonugn/C
+lonusab/B
+loro/A
+loroto/AL
+lorubb/C
+loruk/BL
+loruso/A
+losa/AL
+losan/B
+loso/AM
+losubavl/C
+loto/A
+lotob/BL
+lotu/A
+lotumogk/CL
+lovavadd/C
+lozab/BL
+lozan/BL
+lozomunm/CL
+lozonb/C
+lozulg/CL
+lozuln/C
+lozusud/B
+lubavt/C
+lubut/B
+ludakn/CM
+ludatv/C
+ludu/A
+ludut/B
+lukam/B
+lukododn/C
+lukuk/B
+lukum/B
+lula/A
+lulobulg/C
+lulun/BL
+lulunl/C
+lulutatz/C
+lumad/B
+lumazb/CL
+lumol/BL
+lunotan/B
+lunu/A
+lurano/A
+lurar/B
+lusu/AM
+luta/A
+lutu/A
+lutut/BL
+luvavd/CL
+mabo/AL
+mabulu/A
+mada/A
+madab/BL
+madagr/CL
+madazd/CL
+madunubm/C
+madurog/B
+magako/A
+magub/BM
+maguvuss/C
+maku/A
+makubukd/C
+makut/B
+malamun/B
+malavakt/C
+malokosd/C
+malomuvd/C
+maluz/B
+mamanogk/C
+mamoll/C
+mamuk/BM
+mamun/B
+mamunov/BL
+manatz/C
+manodn/C
+manomz/C
+manu/A
+maramg/C
+marasg/C
+marasz/C
+marost/C
+marugu/A
+masabv/C
+masoba/A
+masok/BL
+masora/AM
+masug/BM
+matutam/B
+mavo/A
+mavor/B
+maza/AL
+mazad/BL
+mazo/A
+mazuvb/C
+meber/BL
+mebid/B
+mebiv/BL
+mebizivz/C
+mede/A
+medebid/BL
+medir/B
+medit/BM
+mege/A
+megebe/AM
+megi/AL
+megidm/C
+megiti/A
+mekegi/A
+mekib/BM
+mekibe/A
+mekimb/C
+mekir/BL
+mekisb/C
+mele/A
+meletl/C
+melevibs/C
+meli/AL
+melid/BM
+melididl/C
+meme/A
+mememeb/B
+mememi/A
+memibe/A
+meneg/B
+menevikn/CM
+menidi/A
+menines/B
+meninig/B
+mere/A
+mereg/BL
+merenet/B
+merer/B
+mereri/A
+meri/AL
+mese/A
+mesedin/B
+meseg/BM
+mesere/A
+mesidiz/B
+mesikt/C
+mesilidb/C
+mesireg/B
+mesirz/C
+mesits/C
+metem/B
+metes/B
+metesz/C
+meti/AM
+metirg/CL
+metitet/B
+meverizs/C
+mevi/A
+mevin/BL
+mezekib/BL
+mezikisb/C
+mezin/B
+mezirs/CM
+mibe/A
+mibig/B
+mide/A
+midebern/C
+midel/B
+mige/A
+migedent/C
+migib/BL
+migidd/CL
+migiselr/C
+mike/AM
+mikemivn/CM
+mikil/B
+mikint/C
+milevetv/C
+milider/BL
+milivem/B
+mimel/B
+mimes/BM
+minev/B
+minik/B
+miredr/C
+mirel/B
+miremi/AL
+miremm/CM
+miretek/B
+miri/AL
+mirid/BL
+miriki/A
+miris/B
+mise/A
+miseg/B
+misenm/CL
+misevd/CM
+misi/A
+misibig/B
+misidb/C
+misized/B
+mitemt/C
+mitigv/C
+mitisk/C
+mitiv/B
+mivi/A
+mivird/C
+mivist/C
+mizern/C
+mizezik/BL
+mizik/BL
+mizimevz/C
+mobu/A
+mobug/B
+mobumosn/C
+modagk/C
+mogatl/C
+mogobus/B
+moko/A
+mokos/BM
+moku/AL
+mokub/B
+molu/AM
+moman/B
+momo/A
+momorb/C
+monan/B
+monarort/C
+mono/A
+monogazm/C
+monokn/CL
+monoro/A
+monos/BM
+monusamn/C
+mora/AM
+morazz/CM
+mosu/A
+mosugv/C
+mosur/B
+mosuts/C
+movudn/C
+movun/B
+mozola/AM
+mozomaz/BL
+mozons/CL
+mozudo/A
+mozurg/C
+mozuv/BM
+muba/A
+mubav/B
+mubobv/C
+mubuk/B
+mubulobz/C
+mudad/BM
+mudazm/CL
+mudusu/A
+mugakovb/C
+mugubo/A
+mugunon/B
+mugunuzn/C
+mugur/B
+muguvur/B
+mukabom/B
+muko/A
+mukoza/A
+mulorat/BL
+mulosb/C
+muma/AL
+mumo/AM
+mumuzunv/CL
+munatosd/C
+muno/A
+munog/B
+munogb/C
+munokak/BM
+munu/A
+munuv/BL
+muradazd/C
+muran/BM
+muraro/A
+muratn/CL
+murorn/C
+murozl/C
+muruz/B
+musab/B
+musabuv/B
+musamn/CL
+musobord/C
+musukots/C
+mutal/B
+mutogutv/C
+muturr/CM
+muturt/C
+muvakumm/CM
+muval/BL
+muvala/A
+muvanos/B
+muzazt/C
+muzobg/CM
+muzozg/C
+muzozo/A
+muzu/A
+muzuvabs/C
+nabad/BL
+nabasag/B
+nabu/A
+nabub/B
+nabuka/AL
+nabuku/A
+nadomr/C
+nadub/B
+nadubu/A
+naduz/B
+naga/A
+nagalo/A
+nagaru/A
+nago/A
+nagog/B
+nagug/B
+naka/A
+nalanur/B
+nalotos/B
+nalu/A
+nalubt/C
+namakomr/C
+namakort/CL
+namono/A
+namu/A
+nanak/B
+nanod/B
+nanu/A
+nanut/B
+narava/A
+narulz/CL
+nasodan/B
+nasosogg/C
+natabk/CM
+natadz/C
+natodo/A
+natut/B
+navamuv/B
+navorord/C
+navukt/C
+navut/BM
+nazarosn/C
+nazaz/B
+nazov/B
+nebed/BL
+nebekim/B
+nebere/A
+nebi/A
+nebil/B
+nededik/B
+nedetg/C
+negib/BL
+negimiz/BL
+nekedidr/C
+nekes/BL
+nekest/CL
+nekevik/B
+nekidb/C
+nekigz/CL
+nekimev/BM
+nekine/A
+nekirikr/C
+neletb/C
+nelev/B
+neleved/B
+nelevik/B
+neli/A
+nelik/B
+nemebidt/C
+nemet/B
+nemibs/C
+nemidm/CL
+nemis/B
+nemivin/BL
+nemizeg/B
+nenen/B
+nenes/B
+nenevem/BM
+nenivv/C
+neri/A
+neribek/B
+nerin/BL
+nerinb/C
+nesizk/C
+netel/B
+neti/A
+netike/A
+netimi/AL
+neve/A
+nevekg/CL
+nevelit/B
+nevi/AL
+nevininz/C
+nevis/B
+nevisn/C
+nezed/B
+nezetb/CM
+nezezid/B
+nezi/A
+nezibz/C
+nezid/B
+neziki/A
+nezilz/CM
+nezinim/BM
+nibe/A
+nibel/B
+nibezeb/BM
+nibik/B
+nibinel/BL
+nide/A
+nideb/B
+nidezitg/C
+nididi/A
+nidivk/C
+nigezi/A
+nike/A
+nikekr/C
+nikelint/C
+nikes/BL
+niketn/C
+nikidek/BL
+nikilims/C
+nikininm/C
+nikitidd/C
+nile/A
+niler/B
+nili/A
+nilimirb/C
+nilivl/C
+nimenil/BM
+nimin/B
+nine/AM
+ninebl/CM
+ninels/CL
+nineze/A
+ninilv/C
+ninime/AL
+niniren/B
+ninis/B
+ninise/A
+nire/AL
+nirevi/A
+nirig/B
+nirim/B
+niriri/A
+nirise/A
+nise/AL
+nisegb/C
+nisegv/C
+nisel/BL
+nisesr/CM
+nisist/CM
+nisizibd/C
+nite/A
+niti/A
+nitibm/CM
+nitim/B
+nitit/B
+nivebe/A
+nivete/AM
+nivik/B
+nivikez/B
+nizebe/A
+nizenivv/C
+nizev/B
+nizidimd/CL
+nizimign/C
+nizirit/B
+nizite/A
+nobag/BM
+nobokakd/C
+nobu/AL
+nobubv/CL
+nodonuz/B
+nodosk/C
+noduzagl/CL
+nogalm/C
+nogava/AM
+nogu/A
+noguv/B
+noka/AM
+nokadr/C
+nokonu/A
+nokub/B
+nolatr/CL
+nolu/A
+noma/A
+nomag/BM
+nomavl/C
+nomoga/AL
+nomor/B
+nomu/A
+nomudb/C
+nonabk/C
+nonaga/A
+nonagk/CL
+nonokov/BM
+norabomn/C
+norasurl/C
+noromobk/C
+norusot/B
+nosa/A
+nosamd/CM
+nosobak/B
+nosu/AL
+notam/BL
+notogugv/C
+notu/A
+novadurr/C
+novo/A
+novolu/A
+novukos/BM
+novumt/C
+novuv/B
+nozorz/C
+nozu/A
+nozuml/C
+nubadm/C
+nubanr/C
+nubo/AL
+nubotg/CM
+nubumuds/C
+nubuv/BL
+nudamu/AL
+nudanl/C
+nudavutn/CL
+nudons/C
+nudu/A
+nudubald/CL
+nuganakg/C
+nugasuz/B
+nugot/BM
+nugozm/C
+nuka/A
+nukora/AL
+nukoto/A
+nuku/A
+nuluk/B
+nulurz/C
+numul/B
+numuz/BL
+nunazok/BL
+nunukot/B
+nunutu/A
+nurak/B
+nurobutz/C
+nurozr/C
+nurunuz/BM
+nusu/A
+nusub/B
+nutobk/C
+nuvamg/C
+nuvogamt/C
+nuvu/AL
+nuvud/BM
+nuzomo/A
+nuzos/B
+nuzurr/C
+rabo/AM
+rabodag/BM
+raburaz/B
+radagosv/C
+radobd/CL
+radol/B
+radub/BM
+radung/C
+radus/B
+raga/AL
+ragagd/CM
+ragakv/C
+ragu/A
+ragubl/C
+rakarv/C
+rana/A
+ranaro/A
+ranol/B
+ranoram/B
+ranurosb/C
+rarara/A
+raro/A
+rarols/C
+rasazv/CM
+rasosaz/BL
+rasott/C
+rasu/A
+ratoz/B
+ratu/A
+ratudv/C
+ravoza/A
+ravozo/A
+ravubom/B
+ravud/B
+ravulo/A
+razok/B
+razuz/B
+rebe/AL
+rebi/A
+rebidemg/CL
+rebigt/CM
+redeseml/CL
+redez/B
+redi/A
+redin/B
+redirs/C
+redizn/C
+regelk/C
+regezl/C
+regi/AM
+rekebisz/C
+rekimt/CM
+rekiz/B
+releri/A
+relezb/C
+reli/AM
+reliv/B
+reme/A
+remekilt/C
+remel/B
+remevinb/C
+remit/B
+remiz/B
+renenels/C
+renibz/C
+renimd/C
+renimirv/C
+renivir/B
+rere/A
+reridz/CM
+rerisi/A
+rese/A
+resi/AL
+resib/B
+retel/B
+retemi/A
+retet/B
+retigi/A
+reve/AL
+reved/BM
+revegd/C
+revest/C
+rezedezs/CL
+rezek/B
+rezemm/C
+rezerl/C
+rezesetl/C
+rezeti/AL
+rezeve/A
+rezez/B
+rezigig/B
+ribebed/BL
+ribekr/C
+ribere/A
+ribi/A
+ribikib/B
+ribizr/C
+ride/A
+ridek/B
+ridekv/C
+ridi/AL
+riditl/C
+rigeki/A
+riges/BM
+rigev/B
+rigibv/C
+rigimk/C
+rigizigr/CL
+rikeges/B
+rikeke/A
+rikekend/CM
+riketi/A
+rikezs/C
+rikib/B
+rikig/B
+rilerel/B
+rilesibv/CL
+rili/A
+rilim/B
+riliset/B
+rilit/BL
+rimemn/C
+rimeretr/C
+rimetv/CL
+rimivz/C
+rinig/B
+rinine/A
+rinite/A
+rirebi/AM
+rirenn/CL
+riridb/C
+risebel/BM
+risi/AM
+risigi/A
+ritel/B
+ritesi/AL
+ritiv/B
+rivi/A
+rivike/A
+rivirevb/C
+rizelz/C
+rizem/BM
+rizikg/C
+rizin/B
+rizivk/C
+robam/BM
+robubon/BM
+robunulv/C
+roda/A
+rodalu/A
+rogabv/C
+rogo/A
+rogotor/B
+rogozg/C
+rokab/B
+rokagb/CL
+rokar/B
+roku/A
+rokur/B
+rola/AL
+rolun/B
+rolusadm/C
+romogm/C
+romus/B
+ronad/BM
+ronug/BM
+roroba/A
+roroto/A
+rorubn/C
+rorumz/C
+rosak/B
+rosalo/A
+rosu/A
+rotanotd/C
+roto/A
+rotutt/C
+rovosurd/CM
+rovu/AL
+rovuka/A
+rozagm/C
+rozazal/B
+rozun/BL
+rozus/BL
+rozutk/C
+ruba/A
+rubagogn/C
+rudamu/A
+rududn/C
+rudult/CL
+rudur/B
+rugamr/C
+ruganol/B
+rugason/B
+rugav/B
+rugotaz/BM
+rugu/AM
+rugutomg/C
+rukakt/C
+ruko/A
+rukobont/CM
+ruku/A
+rukud/B
+rukukak/B
+ruma/A
+rumatg/C
+rumazv/C
+rumo/A
+rumolz/C
+rumub/B
+rumubov/B
+rumuzm/C
+runa/A
+runu/A
+ruranan/B
+ruro/A
+rurum/BL
+rusakd/C
+ruso/A
+rusu/A
+rusudl/C
+ruta/AM
+rutagu/AM
+rutubutk/C
+rutul/B
+sabov/B
+sabugr/CM
+sado/AL
+sadot/B
+sagoruzg/C
+sagumb/CM
+saguvor/B
+sakalob/B
+sakasam/B
+sakodozz/C
+sakovonk/C
+sakusul/B
+salam/BM
+samavuv/B
+samogo/A
+samom/B
+samu/A
+samutagz/C
+sanal/B
+sanol/B
+sanult/CM
+sarom/B
+sarumu/A
+saruvb/C
+sasar/BM
+sasok/BM
+sasoman/B
+sasoz/B
+satavud/B
+satob/B
+savo/A
+savobl/CL
+savors/C
+savugurm/C
+savul/BL
+saza/A
+sazags/C
+sazort/CL
+sazososr/C
+sazumr/CM
+sebe/A
+seben/B
+sebezn/C
+sebik/B
+sebimit/B
+sedebe/A
+sedikisz/C
+sedini/AL
+sege/A
+segetv/C
+segev/B
+segilegd/CL
+seginit/BM
+seke/A
+seker/B
+sekesil/BM
+sekili/AL
+sekinr/CM
+selegilm/C
+selekibm/C
+selemn/C
+seli/A
+selibe/A
+selik/BM
+selizidd/C
+semegez/BM
+semekl/C
+sememk/C
+semetn/C
+semikivz/C
+semitegv/C
+senede/A
+senedibz/C
+senegt/C
+senetir/BL
+senivi/A
+sere/A
+sered/B
+serel/BL
+seretm/C
+serim/B
+serin/BL
+sesegz/C
+sesidit/BM
+sesigi/A
+sesik/B
+sesiv/B
+setetg/C
+setinem/BL
+setite/A
+sevevez/B
+sevilin/BM
+sevin/B
+seze/AL
+sezemk/C
+sezenn/C
+sezesr/C
+sezevin/B
+sezezin/B
+sezikes/BL
+sezived/B
+sibe/AM
+sibebild/C
+sibekv/C
+sibi/A
+sibivi/AM
+sidesz/C
+sidi/AL
+sidib/B
+sidikz/C
+sigegn/C
+siget/BL
+sigi/AL
+sigid/B
+sigired/B
+sigiv/BL
+sigivibl/C
+sike/A
+sikedt/C
+sikeg/BL
+sikes/BM
+siki/A
+sikikinz/CM
+sile/AL
+siledin/BL
+siledit/B
+silek/B
+siliz/BM
+simened/B
+simerl/C
+simikr/C
+simin/B
+simisg/C
+simiv/BL
+sine/A
+sire/A
+sirekik/B
+sirelir/B
+sirem/B
+sirib/B
+siridt/C
+sirigz/C
+sirivemg/C
+sisesg/C
+sisi/A
+sisidis/B
+sisilibl/C
+sisisz/C
+sisit/BL
+sisiziln/C
+site/AM
+sitemikk/C
+siti/A
+sitikg/CM
+sitiriv/B
+sitizb/C
+sive/AL
+sivi/A
+sivib/BL
+sivibk/C
+sivik/B
+sivill/C
+sivisi/AL
+sizede/A
+sizikil/BL
+sizili/AL
+sobakat/B
+sobaral/BL
+sobomobv/C
+soboroll/C
+sobozav/B
+sobudu/AL
+sobukadd/C
+sobuzug/BL
+soda/A
+sodo/A
+sodotu/A
+sodudk/C
+soduvn/CL
+soga/A
+sogob/B
+sogodu/A
+sokokk/C
+solass/C
+solat/BM
+solub/B
+solunt/C
+solusd/C
+somadz/C
+somotol/BM
+somuvusl/CL
+sononav/B
+sonu/A
+sonugn/C
+sonuk/B
+sorods/CM
+sororakl/C
+sorutz/C
+sosa/A
+sosan/BM
+sosobl/C
+sosogom/B
+sososot/B
+sosu/A
+sotorr/C
+sotumoz/B
+sovanl/CM
+sovo/A
+sovogav/BL
+soza/A
+sozar/B
+suba/AM
+subog/B
+subon/B
+subonurb/CL
+subug/B
+suburudt/C
+sudavon/B
+sudulabk/C
+suduzr/C
+sugo/AM
+sugokab/B
+sugoml/C
+suguba/AM
+sukobo/A
+sukodd/C
+sukok/B
+sukun/BL
+sulaks/CM
+sulodull/C
+sulutadm/CL
+sumagas/B
+sumods/C
+sumomavm/C
+sumon/B
+sumons/CM
+sumov/B
+sumugalz/C
+sunat/BL
+sunund/C
+suro/A
+susabad/B
+susaban/B
+susutuns/CL
+sutalm/C
+suto/A
+sutomv/CL
+suva/A
+suvamb/C
+suvut/BM
+suvuvn/C
+suzald/C
+suzasz/C
+suzot/BM
+tabaso/AL
+tabavok/B
+tados/B
+tadub/B
+tagakk/C
+tagott/CL
+tagug/B
+taguvun/B
+takazo/A
+takor/BL
+talo/A
+talod/B
+talul/B
+tamal/B
+tamaru/A
+tamaton/B
+tamav/BM
+tamor/B
+tamoram/BM
+tanan/B
+tano/A
+tanon/B
+tanova/A
+tanozt/C
+tanu/A
+tanuba/A
+tarokuk/B
+tarur/BL
+taruras/B
+tasoda/A
+tasovas/B
+tasuva/AM
+tatulu/AM
+tatuv/B
+tavaro/A
+tavaza/A
+tavula/AL
+tazan/B
+tazuka/AM
+tebe/A
+tebebid/B
+tebign/C
+tebiv/B
+tedebemd/C
+tedess/C
+tedilikt/C
+tedit/B
+tegekez/B
+tegekit/B
+tegi/AM
+tegigen/B
+tegiliks/C
+tegiv/B
+tegivg/CL
+tekege/AL
+teketisl/CL
+teketn/CL
+telez/B
+telid/B
+telim/B
+telirit/B
+teme/A
+tememd/CL
+temet/B
+temin/BL
+temizr/C
+temizz/C
+tene/AL
+teneb/B
+teneke/A
+tenelemr/CL
+teni/A
+tenivits/C
+tere/AL
+terekb/C
+terevt/CL
+teri/A
+terinizl/CM
+teris/B
+tese/A
+tesem/B
+tesis/B
+tesit/BL
+tete/A
+teteb/B
+tetett/CM
+teti/AL
+tetid/B
+tetit/B
+teve/A
+tevevl/C
+tevidez/BM
+tevign/CM
+tevik/BM
+tezibiv/BL
+tezirikz/C
+tibe/A
+tibi/A
+tibid/B
+tibite/A
+tide/A
+tideb/BL
+tidi/A
+tidims/CL
+tidit/B
+tige/AM
+tigeb/BL
+tigesir/B
+tigi/AL
+tigikn/C
+tikev/B
+tikezv/C
+tikimimz/CL
+tile/A
+tiledz/C
+tileti/A
+tili/A
+tiligit/B
+tilir/B
+tilirl/C
+time/A
+timekib/B
+timene/A
+timeni/AL
+timez/BL
+timezm/C
+timinikr/C
+tine/AL
+tinezv/CM
+tini/AM
+tinisk/CM
+tirezik/B
+tiril/B
+tirisim/B
+tiriv/BL
+tiriz/B
+tiser/B
+tite/A
+titerl/C
+titi/A
+titil/BL
+titizg/C
+tive/A
+tivegk/CL
+tivem/B
+tiveve/A
+tivilitg/C
+tize/AM
+tizenk/C
+tizesk/C
+tizetb/C
+toba/A
+tobonav/B
+toborv/C
+tobun/B
+toda/A
+todat/BL
+todo/A
+todu/A
+todutamd/CL
+togor/B
+togugul/BM
+tokada/AL
+tokaku/AL
+tola/AM
+tolab/B
+tolok/B
+tolov/B
+tolukg/C
+toma/AM
+tomozomt/C
+tomunos/B
+tomuvutt/C
+tonalm/C
+tonovk/C
+tonubo/A
+tonug/B
+tonuvuvd/C
+toru/A
+tosogl/C
+tosom/BM
+tosorl/C
+tosub/B
+tosutk/C
+tota/A
+totosm/CL
+tovokg/C
+tozaku/A
+tozara/A
+tozo/A
+tozod/B
+tozugl/C
+tozun/B
+tuba/A
+tubaga/AM
+tubutn/C
+tuda/A
+tudab/B
+tudozr/C
+tugoku/A
+tugus/B
+tuka/A
+tukas/BL
+tukobn/CL
+tukodudt/CL
+tuku/A
+tukub/BL
+tulazk/C
+tulul/B
+tumadd/C
+tumazn/CL
+tumobt/C
+tumubu/AM
+tumurn/CM
+tunuro/A
+tunusalt/C
+turalu/A
+turog/BL
+turud/B
+tusovazz/C
+tusu/A
+tusunakz/C
+tusut/BL
+tutarz/C
+tutazadk/C
+tutola/A
+tuvan/B
+tuvatt/C
+tuvub/B
+tuvugv/CL
+tuvuml/C
+tuza/AL
+tuzadz/C
+tuzo/AL
+tuzogasd/C
+tuzolukm/C
+tuzovm/C
+tuzubumz/C
+vabogl/C
+vabok/BL
+vabukm/C
+vada/AL
+vadozl/C
+vadular/B
+vaduz/BL
+vaguka/A
+vaguvur/BM
+vakab/BL
+vakagug/B
+vakaza/A
+vakod/B
+vaku/AL
+vakuku/A
+vakulu/A
+vakus/B
+valo/A
+valodg/C
+vama/A
+vamov/BM
+vanaso/A
+vanavu/A
+vanu/A
+vanug/B
+vanura/A
+vanuros/B
+vara/A
+varo/A
+varoko/A
+varokonv/C
+varurg/CM
+vasum/BM
+vasunl/CL
+vasusan/B
+vatavv/C
+vatog/B
+vatoloms/C
+vatosol/BL
+vavar/B
+vavugg/C
+vavukr/C
+vaza/A
+vazano/A
+vazul/B
+vebek/BM
+vebemd/C
+vebimd/C
+vebimitb/C
+vebinenk/C
+vebism/C
+vedezs/C
+vediger/B
+vedik/B
+vedimb/CM
+vedivs/C
+vege/A
+vegedir/B
+vegel/B
+vekems/C
+vekesz/C
+vekev/B
+vele/A
+veleb/B
+velebi/A
+velebivz/C
+velenel/B
+velenem/B
+velev/B
+velez/B
+vemeb/B
+vemesi/A
+vemisb/C
+vene/A
+venedi/A
+veni/AL
+venin/B
+vererisk/C
+veseder/B
+vesers/C
+veses/B
+vesib/BM
+vesis/B
+vete/A
+veteki/AL
+veterebb/C
+vetigg/CL
+vevedid/B
+veveli/A
+vevelt/CL
+vevi/A
+vevin/BL
+vevis/B
+vevite/A
+vevitid/B
+veviz/B
+veze/A
+vezeredn/C
+vezi/A
+vezibet/B
+vezirent/C
+vezisebd/C
+vibe/AL
+vibekemb/CL
+vibekig/B
+vibenel/BL
+vibeni/AL
+vibi/AL
+vibibir/B
+vibils/C
+vibir/B
+viderev/B
+videsm/C
+vidi/A
+vidikiv/B
+vidilebb/C
+vidinl/C
+viged/B
+vigeg/B
+vigenn/C
+vigikn/C
+vigini/A
+vigisib/BL
+vikeb/B
+viki/AM
+vile/AL
+vileki/A
+vilet/B
+vilevilz/CL
+vilivi/A
+vimegedl/CM
+vimi/A
+vimid/B
+vimirb/C
+vimiv/B
+vined/B
+vineli/A
+vinisi/A
+vire/A
+viri/A
+virid/BM
+viril/B
+visess/C
+visevev/B
+visi/A
+visimb/C
+vitebm/C
+vitedi/AM
+vitezi/A
+vitezis/B
+viti/A
+vitide/A
+vitigk/C
+vitikivm/CL
+vitis/BL
+vitisv/C
+vivedl/CL
+vives/B
+vivil/BL
+vize/AL
+vizeg/BM
+vizinv/CM
+vizit/B
+voba/AM
+vobabogz/C
+vobo/A
+vobodosz/C
+vobogt/CM
+vobok/B
+vobon/B
+voboz/B
+vobuzn/C
+vodava/AM
+vodob/B
+vogagb/CM
+vogan/B
+vogo/A
+vogomg/C
+voka/AL
+volu/A
+volug/B
+volunub/B
+vomudg/C
+vona/AL
+vonast/C
+vonatn/CM
+vono/AL
+vonodl/C
+vonogn/C
+vonub/B
+vonubods/C
+voragotr/C
+vorob/B
+vorobakt/C
+vorubv/C
+vosodn/C
+votosudv/C
+votut/BL
+vova/A
+vovosu/AM
+vovotov/B
+vovulokd/C
+vovuno/A
+vozobun/B
+vozon/BM
+vubosa/AL
+vubu/A
+vubuma/A
+vudad/B
+vudagu/A
+vudo/A
+vudub/B
+vudumr/C
+vuduz/B
+vugagav/B
+vugo/A
+vugos/B
+vuguss/C
+vukab/B
+vukas/B
+vukokt/CL
+vukor/B
+vulad/B
+vuma/A
+vumalak/B
+vumo/AM
+vumob/B
+vumur/B
+vunadv/CL
+vura/AL
+vurulon/B
+vusa/A
+vusada/AL
+vusobozg/C
+vusotg/CL
+vusug/B
+vusuroz/BL
+vutal/B
+vutom/BM
+vutu/A
+vuvolot/BL
+vuvu/A
+vuvudo/AM
+vuvudv/CM
+vuzugu/A
+vuzulv/CM
+vuzuma/A
+vuzurukd/CM
+zabo/A
+zadazu/A
+zado/A
+zadu/AL
+zagagozv/CL
+zagatotg/C
+zagos/B
+zakom/B
+zakozorn/C
+zalob/B
+zamudasm/C
+zanan/B
+zanazl/C
+zanozugb/CM
+zanu/A
+zanunumn/C
+zarodo/A
+zasa/AL
+zasaz/BM
+zasorz/CL
+zata/A
+zatokk/C
+zatudm/C
+zavarl/C
+zavazo/A
+zavoto/A
+zavozass/CL
+zavu/A
+zavun/B
+zavusu/A
+zazoz/BL
+zazubo/A
+zazudd/C
+zazutu/A
+zebevk/C
+zebi/A
+zebitetr/C
+zebitl/CM
+zebitr/C
+zebizz/C
+zede/AM
+zedegers/C
+zedi/AM
+zeged/B
+zegikv/C
+zeke/A
+zekeke/A
+zekerev/BM
+zeket/B
+zekevigd/C
+zekiveb/BL
+zele/A
+zelekk/C
+zeli/A
+zelibr/C
+zelik/B
+zelins/C
+zeme/A
+zemeld/C
+zemes/B
+zemig/B
+zemign/C
+zemikibr/C
+zemine/A
+zemint/C
+zenekelb/CL
+zeneligl/C
+zenems/C
+zereb/B
+zeregel/BM
+zeri/AL
+zerik/BL
+zeririb/BL
+zesib/BL
+zesige/AM
+zesin/B
+zesiz/BL
+zesizin/B
+zesizis/B
+zete/A
+zeteb/B
+zetevid/B
+zetidd/C
+zetilelv/CL
+zeveki/A
+zeveleb/BL
+zevemi/A
+zeveml/C
+zevent/C
+zeveri/A
+zeveven/B
+zevevinm/C
+zevi/A
+zevikis/B
+zevin/B
+zevis/BL
+zeze/A
+zezereb/B
+zezi/AM
+zezirg/CM
+zibez/B
+zibi/A
+zide/A
+zidebe/A
+zidebis/B
+zided/B
+zidek/BM
+zidi/A
+zigi/A
+ziginisn/C
+zigizi/A
+zikedd/C
+zikeli/A
+zikene/A
+zikim/BL
+zile/A
+zilekevz/C
+zilene/A
+zili/A
+zilibz/CL
+ziligigl/CM
+zilim/BM
+zilit/BL
+zime/AM
+zimeb/B
+zimedl/CL
+zimeg/B
+zimes/B
+zimete/A
+zimi/AM
+zimidm/C
+zimim/B
+zimit/B
+zine/AM
+zinel/B
+zinib/B
+zinidm/C
+ziniz/B
+zired/B
+ziretg/CL
+ziridi/A
+ziriz/BM
+ziseg/B
+ziser/B
+zisete/A
+zisevb/C
+zisever/B
+zisi/A
+zisidm/CL
+zisig/B
+zisigd/C
+zisigs/C
+zisikm/CM
+zisisemt/C
+zisisib/B
+zisisn/CM
+zite/AL
+zitebn/C
+zited/B
+zitedes/B
+zitikz/C
+zitinn/CL
+zitir/B
+zititn/C
+zivegb/C
+ziverel/B
+zivevv/C
+zivez/B
+zivi/A
+zizede/A
+zizedm/C
+zizen/B
+zizideb/B
+zizigd/C
+zizind/C
+zizitizb/CM
+zizizs/CL
+zobak/B
+zobaroz/BM
+zobat/B
+zodarud/B
+zodog/B
+zodosa/A
+zodov/B
+zodurg/CM
+zoduvabs/C
+zogobb/C
+zogu/A
+zogurr/C
+zokaba/A
+zokabl/CL
+zokaml/C
+zokog/B
+zokork/C
+zokudorv/C
+zokukn/C
+zolang/CL
+zolo/A
+zolugr/C
+zoma/A
+zomagarr/C
+zomarus/B
+zomo/A
+zomodo/A
+zomog/B
+zonazunt/C
+zonok/B
+zonosa/A
+zonub/B
+zorarz/C
+zoravn/C
+zorogl/CM
+zoruz/B
+zosak/B
+zosogv/C
+zosomulg/C
+zososs/C
+zosubuns/C
+zotabz/C
+zotozb/CL
+zotuv/B
+zotuvm/C
+zovasob/B
+zovomb/C
+zovosug/B
+zovub/B
+zozakt/C
+zozodusl/CM
+zubav/BL
+zubom/B
+zuboss/CL
+zubu/A
+zuda/A
+zudagv/C
+zudanub/B
+zudugn/C
+zuduv/B
+zuga/A
+zugobodz/CM
+zugovl/C
+zuka/A
+zukag/BM
+zuko/A
+zukuto/A
+zula/AM
+zulag/B
+zularu/A
+zulo/A
+zulom/B
+zumata/AL
+zumovad/B
+zunabr/CL
+zunot/B
+zunuru/A
+zunutus/B
+zuranodg/C
+zurol/B
+zurulm/C
+zusark/C
+zusasd/C
+zusor/B
+zuta/AL
+zutatb/CM
+zutov/BL
+zuvaga/AL
+zuvam/B
+zuvogond/C
+zuvosumd/CL
+zuvuluv/BM
+zuvun/B
+zuzosoz/B
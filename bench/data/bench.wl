@@ -0,0 +1,2207 @@
+aa
+abbreviate/DN
+abbreviation/S
+ability
+able/U
+abort/SG
+about
+above
+absence
+absolute/Y
+accent/SD
+accept/SGD
+acceptable
+acceptance
+access/GD
+accessible
+accessors
+accidently
+accompany/GS
+according
+account
+accum
+accurate
+accustom
+achieve
+acknowledgements
+act/GVD
+actions
+activate
+actual/Y
+add/GDS
+addition
+additional
+address/DS
+adequately
+adjacent
+adjusting
+adjustment
+admittedly
+advanced
+advantage/S
+ae
+aeiou
+af
+aff
+affect/D
+affix/S
+africa
+after
+again
+against
+age
+agents
+aggregate/N
+ago
+agreement
+ahead
+ak
+algorithm/S
+alias/S
+alignment
+all
+allegation
+allocate/D
+allow/SDG
+almost
+alone
+along
+alpha
+alphabet
+alphabetic
+alphabetical
+already
+also
+alt/R
+alternate
+alternative/SY
+although
+altogether
+always
+am
+ambiguous
+american
+amf
+among
+amount
+amp
+an
+analysis
+and
+annotated
+annoying
+another
+any
+anyone
+anything
+anyway
+anzi
+apart
+apostrophe
+appear/GDS
+appearance
+append/GD
+appendices
+appendix
+applicable
+application/S
+apply/NDS
+appropriate/Y
+approved
+approximation
+ar
+arbitrary
+architecture
+archive
+are
+area/S
+args
+argument/S
+argv
+arise
+around
+arranged
+arrangement/S
+array/S
+as
+ascii
+ask/GD
+aspel
+aspell
+assembled
+assert
+assigned
+associate/VD
+assume/GDS
+assure
+ast
+asymptotically
+at
+atkinson
+attach/D
+attempt
+attemt
+attention
+attrib
+attribute/S
+author/S
+authoritative
+authorized
+authorship
+auto
+autoconf
+autogen
+automake
+automated
+automatic
+automatically
+av
+available
+average
+avoid/S
+aware
+away
+awli
+ay
+az
+ba
+back
+backup
+backward
+bad/Y
+bagging
+bak
+balance
+ban
+bar
+base/D
+bash
+basic
+basically
+basis
+batch
+be/T
+beaning
+because
+become/S
+been
+before
+began
+begging
+begin/S
+beging
+beginning
+begng
+begning
+begun
+behalf
+behave
+behavior
+behind
+being
+believed
+belong/SG
+below
+bem
+beneficial
+benefit
+better
+between
+beyond
+bi
+big
+bigger
+biggest
+bin
+binary/S
+bindir
+bit/S
+bitching
+bjoern
+bla
+blank
+blindly
+bloat
+block/S
+bo/H
+body
+bold
+book/S
+bool
+boolean
+borel
+borrowed
+both/R
+bottom
+bough
+bound/D
+bracket/S
+branch
+break/G
+brief
+bring
+broken
+broth/R
+brothe
+buffer
+bug/S
+build/SG
+built/A
+bunch
+but
+button/S
+by
+byrial
+byte/S
+ca
+cache/G
+call/GSD
+callable
+came
+can
+candidate/S
+cannot
+canonical
+cantradiction
+capable
+capitalization/S
+capitalized
+care
+carefully
+carry
+case/S
+cast
+cat
+catagory
+category/S
+cause/DSG
+ce
+ceb
+cellpadding
+cellspacing
+centradiction
+certain/Y
+challenge
+chance
+change/GDS
+changed/U
+chapter
+char/S
+character/S
+charge
+charset/S
+chart/R
+charter/S
+cheaper
+check/DRSG
+checker/SG
+children
+choice
+choose/G
+chopped
+chose
+chosen
+circumstance/S
+claim/S
+clarifications
+clarity
+class/S
+clean/Y
+cleanup
+clear/DRY
+clone
+close/DRSTG
+cmap
+co
+code/GS
+codebase
+codepage/S
+coexist
+colection
+collect/VD
+collection
+colon
+column/S
+com
+combination/S
+combine/GD
+combined/U
+come/GS
+comma/S
+command/S
+comment/GS
+commenting/U
+commercial/Y
+commit
+common/Y
+communicate/N
+comp
+compact
+company/S
+comparable
+compare
+comparison/S
+compatibility/I
+compatible/I
+compatibly
+compelled
+compensation
+competing
+compilation
+compile/AGD
+compiler/S
+complain
+complements
+complete/DY
+compliance
+compliant
+complicate/D
+component/S
+composed
+composition
+compound/S
+compress/D
+compressed/U
+compression
+compute/DR
+concatenate
+conceivable
+concerns
+cond
+condition/S
+conditional/U
+conf
+config
+configuration
+configure/DG
+conflict
+conform/G
+confusion
+connection
+consecutive
+consequence/S
+consider/D
+consideration
+consist/SG
+consistent
+console/S
+consonant/S
+conspicuously
+const
+constant/SY
+constitute
+construction
+constructor/S
+contact
+contain/GSD
+content/S
+contest
+context/S
+continue/S
+continuous
+contradict/S
+contradiction
+contrast
+contribute/ND
+contributers
+contribution/S
+contributor
+control/S
+controlled
+conv
+convenient/Y
+convention/S
+conversion/S
+convert/GDS
+convey/D
+coordinate
+cop
+copacetic
+copy/GDS
+copyleft
+copyright/D
+cor
+core
+corpus
+correct/IY
+corrected
+correction/S
+corresponding
+cost
+could
+count/SDR
+counter/S
+country/S
+course
+court
+cout
+cover/DS
+crash
+crawling
+create/GNDS
+credit
+criteria
+cross/D
+crubadan
+cse
+cuntradiction
+current/Y
+curses
+custom/R
+customarily
+customizable
+customized
+cut
+cy
+cycle
+cygwin
+da
+dash/S
+dat
+data
+datablock
+date
+day
+de/S
+deal/SG
+debian
+debug
+debugger
+debugging
+decent
+decide/D
+decimal
+decision
+declaration
+declared
+decoder
+decoding
+decomposed
+decomposing
+decomposition
+decrease/DS
+dedications
+deep
+default/S
+defination/S
+define/DS
+defined/U
+definitely
+definition/S
+degrade/S
+delete/GND
+deletion/S
+delimited
+delimiter/S
+delimiting
+delimits
+demonstrates
+demonstrating
+denote/SG
+deny
+depend/SG
+dependency
+dependent/I
+derefrenced
+derivative/S
+derive/D
+desc
+describe/DSG
+description
+designate/D
+designed
+desire/D
+destroyed
+destructor
+detachable
+detail/DSG
+detailmenu
+detect/S
+determine/S
+dev
+devel
+develop/DRG
+developer/S
+development
+device
+dict/S
+dictionary/S
+did
+didn
+die
+diff
+differ/GS
+difference/S
+different/Y
+difficult
+digit
+dir
+direct/GVY
+direction
+directly/I
+directory/S
+direntry
+disable/GDS
+disadvantages
+disagreement
+disallowing
+disappear
+disclaimer/S
+disclaiming
+disclaims
+discourage/D
+discretionary
+discussed
+discussing
+disk
+display/SDG
+dist
+distance/S
+distinct
+distinguish/DG
+distribute/AGN
+distributed
+distributor/S
+divided
+do/G
+doc
+document/SD
+documentation/S
+does
+doesn
+dog/S
+don
+done
+donor
+dont
+double/D
+doubly
+down
+download/S
+draft
+drawing/S
+dress
+driven
+drives
+driving
+drop
+dropping
+dual
+due
+dumb
+dump/GD
+duplicate/GS
+duration
+during
+dvorak
+dyu
+each
+earlier
+eases
+easily
+easy/RT
+echo
+ed
+edit/DS
+editdist
+edition
+editor/S
+edu
+ee
+effect/SV
+effective/Y
+efficiency/I
+efficient/Y
+effort/S
+egcs
+either
+el
+electronic
+elements
+eliminated
+eliminating
+else
+elsewhere
+emacs
+email/S
+employer
+empty
+emulate/N
+en
+enable/GDS
+enclose/DG
+encode/DRG
+encoding/S
+encourage
+end/GS
+endian/P
+ending/S
+endl
+endorsement/S
+enforcing
+engineering
+engines
+english
+enhance/GD
+enhancements
+enlargethispage
+enough
+ensure
+enter/D
+entire/Y
+entitled
+entity/S
+entry/S
+enum
+enumerate/N
+env
+environment/S
+eo
+equal/Y
+equivalent
+erase
+err
+error/S
+es
+escape/DS
+especially
+et
+etc
+ethical
+ethnologue
+eu
+even
+event
+eventually
+ever
+every
+everyone
+everything
+evil
+exact/Y
+examined
+example/S
+excellent
+except/D
+exception/S
+exchange/S
+excluded
+excluding
+exclusion
+exclusively
+excuse
+exe
+executable/S
+execute/N
+exercise
+exist/SG
+existence
+exit/G
+expand/DS
+expansion/S
+expect/GDS
+expense
+experience
+experimenting
+explain/DG
+explanations
+explanatory
+explicit/Y
+exploiting
+exploits
+expressed
+expression/S
+expressly
+extend/D
+extension/S
+extensively
+extent
+external
+extra
+extract/D
+extremely
+ey
+fa
+facility/S
+fact
+facto
+factors
+fail/S
+fairly
+faith
+fall/S
+false
+far
+fashion
+fast/RT
+fault
+favorite
+feasible
+feature/S
+fee/D
+feedback
+feel
+fell
+fetched
+few/RT
+fi
+field/S
+figure
+file/S
+fileextention
+filename
+fileno
+filling
+filter/S
+filtername
+filtertype
+final/Y
+find/SG
+fine
+finished
+first
+fit/S
+five
+fix/DS
+flag/S
+flagged
+flexible
+flock
+fo/I
+focus
+fold
+folling
+follow/DSG
+followup
+folowing
+fone
+font
+foo
+fool
+footprint
+for
+forbid
+force/G
+foreign
+foreigners
+foreseeable
+forget
+forgot
+forgotten
+form/GDR
+formal/I
+format/GS
+formatted
+formatter/S
+formatting
+formed/I
+found
+four
+framework
+free
+freedom/S
+frequency
+frequent
+friendly
+from
+front
+fstream
+fulfill
+full
+fully
+fun
+func
+function/S
+functional/Y
+functionality
+funetik
+fur
+further
+fussy
+future
+fy
+ga
+gain
+gathered
+gave
+genconv
+general/Y
+generalized
+generate/GND
+generating/A
+generic
+generous
+geocities
+geoff
+geographical
+german
+get/S
+gettext
+getting
+give/SG
+given
+global
+gnome
+gnu
+go/G
+goals
+goes
+good
+gov
+gram
+grammar
+granted
+grants
+gratis
+great/RT
+grep
+gross
+group/SDG
+grown
+grows
+gu
+guarantee/D
+guess
+guide/D
+ha/S
+hack/R
+had
+half
+hallo
+han
+handle/GDS
+handled/U
+handy
+hangul
+hapoy
+happen
+happy
+hard
+harm
+hash
+hate
+have/G
+haw
+he
+head/R
+header/S
+hear
+heavy
+hedaer
+held
+hello
+help/SGDR
+hence
+here
+hereby
+herein
+heritage
+hi/S
+hidden
+hide/GS
+high/RY
+highlight/D
+hil
+him
+hint
+hiragana
+historical
+hit
+ho
+hold/GSR
+holder/S
+home
+homepage
+hope/D
+hopefully
+host
+how
+however
+hu
+huge
+human
+hy
+hyphen/S
+hyphenation
+ia
+iba
+id
+idea/S
+identical
+identifiable
+identify/NS
+ie/D
+if
+ifinfo
+ifnottex
+iftex
+ig
+ignore/DG
+ii
+illustrates
+ilo
+image/S
+imagine
+img
+immediately
+impl
+implement/GD
+implementation/S
+implemented/U
+implicitly
+imply/DGN
+import/D
+important/Y
+impose/D
+impossible
+improve/GDS
+improvements
+in
+include/GDS
+incompatibility/S
+incorporate/S
+increase/S
+increment/DG
+indent/GD
+index/DS
+indicate/GNDS
+indicator
+individual/Y
+induce
+infile
+infinite
+infinity
+influence
+information
+infringe
+infringement
+inherit/SD
+initial
+initialized
+initscr
+inline
+inplace
+input
+insane
+insert/GD
+insertions
+insist
+inst
+install/UGD
+installation
+installer
+installs
+instead
+instruction/S
+int
+intact
+integer
+integrate
+integrity
+intelligent/Y
+intend/D
+intended/U
+intent
+interactive/Y
+interchange/G
+interdependencies
+interest/DG
+interface/S
+interfering
+interior
+internal/Y
+international
+interpreted
+intersolinc
+intervention
+introduced
+invent
+invoked
+involved
+involves
+involving
+io
+iostream
+irreversible
+is
+isn
+iso
+isolation
+ispell
+issue/S
+istream
+it/S
+item/S
+itemize
+iterate/G
+iterator
+itself
+ja
+jacke
+jamo
+job/S
+joining
+json
+judgment
+jump
+just
+ka
+kac
+kanji
+katakana
+kde
+kdstevens
+keep/GS
+kepmapping
+kept
+kernel
+kevin
+kevina
+kevinatk
+key/S
+keyboard/S
+keymap
+keymapping/S
+keyword/S
+ki
+kind
+knobs
+know/S
+known/U
+ko
+kok
+kspell
+ku
+ky
+la
+label
+lacks
+laid
+lang
+language/S
+large/R
+laspell
+last
+later
+latest
+latex
+latter
+law
+lax
+layer
+layout/S
+lead/G
+leak/S
+learn/G
+least
+leave/S
+ledgerline
+leditdist
+left
+legal/Y
+legibly
+lend
+length
+less/U
+let
+letter/S
+level
+leviosa
+lexicographic
+li
+lib/S
+libaspell
+libcurses
+libcursesw
+libdir
+libncursesw
+library/S
+libspell
+libstdc
+libtool/S
+license/GDS
+licensee/S
+licensor
+light
+lightweight
+like/UY
+likewise
+limit/GD
+limitation/S
+limited/U
+line/S
+linear
+lingucomponent
+link/DRGS
+linkage
+lisp
+list/DS
+literal/YS
+little
+lncurses
+lo
+load/GD
+loadable
+loc
+local
+locale
+located/A
+location/S
+locks
+log
+logographic
+long/R
+look/GSD
+lookup/S
+loop
+lose
+lossy
+lost
+lot
+loud
+lower
+lowercase
+lowest
+lset
+lu
+lucida
+luo
+lyxrc
+maccy
+machine/S
+macro/S
+made
+magic
+magnitude
+mail/GR
+main
+maintainer/S
+maintains
+major
+make/SG
+makeinfo
+man
+manage/GDR
+management
+mandatory
+manipulate
+manual/YS
+many
+map/S
+mapped/UA
+mapping/S
+margin
+marked
+marker
+markup
+mask
+massive
+master
+match/GDS
+material/S
+mathematics
+matter/S
+maximum
+may
+maybe
+mblen
+me/D
+mean/SG
+meaningful
+meant
+meantime
+measures
+mechanism
+media
+medical
+medium
+meet
+member/S
+memleak
+memory
+mentioned
+menu
+mere
+merge/GD
+message/S
+met
+meta
+metafilter
+metaphone
+method/S
+mi/S
+middle
+might
+mimic
+min
+mind
+minimal
+minimum
+minor
+minute
+miscellaneous
+miss/GS
+misspell/SDG
+misspelling/S
+mistakes
+mixed
+mixing
+mixture
+mkchardata
+mmap/D
+mno
+mo/S
+mode/S
+modification/S
+modified/U
+modifiers
+modify/DSNG
+module/S
+moment
+monster
+more
+most/Y
+mounted
+move
+much
+multi
+multiple
+multiprocess/S
+multitable
+munch/D
+munchlist
+munmap
+must
+my
+myself
+myspell
+mystery
+naive
+name/GDS
+namespace
+naming/A
+namme
+nasty
+native
+natural
+ncurses
+ndebug
+ne
+near/Y
+necessarily
+necessary/U
+need/DS
+neither
+net
+network
+never
+new/SRY
+newline/S
+newoption
+newsbody
+newsletters
+next
+ngram
+nice/R
+no
+nodes
+non
+noncommercially
+none
+nontrivial
+nor
+noregex
+norm
+normal/Y
+normalization
+normalize/G
+nospellcheck
+not
+note/S
+nothing
+notice/S
+noticeable
+now
+nroff
+nso
+null
+num
+number/DSG
+numerical
+numerous
+ny
+obj
+object/S
+obligations
+obscure
+obsolete
+obstruct
+obtained
+obtaining
+oc
+occasions
+occur/S
+occurred
+occurrences
+odd
+of
+off/R
+offer/G
+official/U
+offset/S
+often
+ogi
+old/R
+om
+omit
+omitted
+omniglot
+on/Y
+once
+one/S
+onlinedat
+onto
+oo
+open/SD
+openoffice
+operate/SG
+operator/S
+opt
+optimization
+optimum
+option/S
+optional/Y
+or
+order
+ordinary
+ore
+org
+organization
+origin
+original/Y
+orn
+os
+ostream
+other/S
+otherwise
+ough
+our
+out
+outfile
+output/S
+outputting
+outside
+over
+overall
+overhaul
+override/S
+oversight
+overwrite
+overwritten
+own
+ownership
+pa/H
+package/DS
+page/S
+paint
+pair/S
+paivakil
+pam
+pap/R
+parallel
+parameter/S
+parentheses
+parms
+parse/G
+part/S
+partial/Y
+participate
+particular/Y
+party/S
+pass/GD
+passage/S
+patch/S
+patent/S
+pdcurses
+peacefully
+peer
+people/S
+per
+perfectly
+perform/DGS
+performance
+perhaps
+period
+periodically
+perl
+permission/S
+permit/S
+permitted
+permitting
+personal
+persons
+pertinent
+philosophical
+phone
+phoneme
+phonet
+phonetic/S
+phototype
+phrase/S
+physical
+picky
+pico
+pieces
+pipe
+pixels
+pkgdatadir
+pkglibdir
+place/DSG
+plain
+plan
+platform/S
+play
+please
+plug
+pluggable
+plus
+po/S
+pod
+point/RSG
+pointer/S
+political
+pool
+poorly
+popt
+port
+portability
+portion/S
+pose
+posib
+position
+possesses
+possible
+possibly
+posted
+potential/Y
+powerful
+practices
+pragmatic
+prdouct
+preamble
+prebuilt
+preceded
+preceding
+precise/Y
+precomposed
+preferable
+preferred
+prefix/DS
+preliminary
+preparation
+prepared
+prepl
+presence
+present/AS
+preserve/SG
+press/DS
+prevail
+previous/Y
+prezip
+price
+primarily
+principal/Y
+print/SGD
+printable
+printf
+prior
+priority/S
+private
+probably
+problem/S
+proc
+process/DSG
+processor/S
+produce/DS
+produced/A
+product/S
+prog
+program/S
+programmatic
+programmer/S
+programming
+progress
+prohibited
+prominent
+promoting
+prompt
+pronounced
+pronunciation
+proof
+proofread
+proper/Y
+property/S
+proprietary
+prospective
+protect/DGV
+protection
+protocol/S
+prototype
+provably
+prove
+provide/DSG
+provisions
+prudent
+pspell
+psychologist
+psychology
+psycolagest
+public/Y
+publicity
+publish/DR
+publisher/S
+punctuation
+purpose/S
+put/S
+putting
+pwli
+qu
+qualify/D
+quality
+quantity
+question
+qui
+quick/Y
+quite
+quo
+quot/DG
+quotation
+quote
+ra
+race
+random
+range
+rare/Y
+rather
+raw
+reachable
+reached
+reaching
+read/GR
+readability
+readable
+reader/S
+readme
+ready
+real/Y
+reason/S
+reasonable
+reasonably
+rebuild
+receive/DSG
+recent/Y
+recipient/S
+recognition
+recognize/DSG
+recommend/D
+rectify/D
+recursive
+redesign
+reduce/D
+redundant
+refer/S
+reference/S
+referring
+reflect
+refrain
+refused
+regarding
+regardless
+regards
+regex
+region
+registers
+regular/Y
+regularity
+rejected
+relate/NVD
+relational
+relationship
+release/DG
+relevant
+reliance
+relink
+relocatable
+rely/D
+rem
+remain/GS
+remapping
+remember
+remove/GD
+rendered
+rensen
+reorganized
+repeat/D
+repl
+replace/D
+replacement/S
+replied
+report/SDG
+repository
+represent/DG
+representation/S
+reproducing
+reputation
+requested
+requests
+require/DSG
+requirement/S
+reset
+resides
+resorting
+respect/S
+respectfully
+respectively
+responding
+response
+responsibility/S
+responsible
+rest
+restrict/VD
+restricted/U
+restrictions
+result/SG
+ret
+retailers
+retitle
+retrieved
+return/G
+reuse
+reverse/G
+reverts
+review
+revised
+revising
+rework/D
+rewrite
+right/S
+ription
+rmarc
+ro
+robust
+role
+romaji
+root/S
+rough/Y
+row
+royalty
+ru
+rudimentary
+rule/S
+run/S
+running
+runtime
+rutgers
+sa
+safe/YT
+safety
+said
+same
+sample
+satisfy/S
+savannah
+save/GDS
+say/GS
+scan/S
+scanned
+scannell
+scanning
+scheme
+school
+scope
+score/SG
+scowl
+scratch
+screen
+script/S
+se/D
+seam
+search/GDS
+second/S
+section/S
+see/S
+seeing
+seem/S
+seen
+segmentation
+segments
+select/DS
+selection
+self
+semantics
+semicolons
+send/GS
+sense
+senseless
+sensitive/I
+sent
+sentence/S
+separate/YGD
+sequence/S
+serious
+server
+service/S
+session
+set/S
+setq
+setting
+setup
+several
+share/DG
+sharedir
+she
+shells
+shipped
+short/R
+shortcut
+should
+show/S
+shown
+shqip
+si
+sicolagest
+side/I
+sign/SD
+signature
+signed/U
+significant/Y
+similar
+simpile
+simple/R
+simplicity
+simplify/D
+simply
+simultaneously
+since
+single
+singly
+situation
+size
+sketchy
+skills
+skip/S
+skipped
+skipping
+slang
+slight/Y
+slink
+slow/R
+slu
+small
+smallexample
+smart
+snapshot
+so
+software
+sole/Y
+solution
+solve/D
+some
+somehow
+someone
+something
+sometimes
+somewhat
+somewhere
+soname
+soon
+sophisticated
+sort/D
+sound/S
+soundslike/S
+source/S
+sourceforge
+space/S
+speak/G
+special/Y
+specialized
+specific
+specifically
+specify/NGDS
+sped
+speed/S
+spell/DRG
+spellcheck/G
+speller/S
+spelling/S
+spent
+spirit
+split
+splitting
+spoken
+square
+stack
+stage
+stand/S
+standard/S
+star
+start/GSD
+startes
+startup
+state/DSG
+statement/S
+static
+statically
+statistics
+stats
+status
+stay/D
+stderr
+stdexcept
+stdout
+step/S
+stevens
+still
+stop/S
+stopped
+storage
+store/DSG
+straightforward/Y
+strange
+strategy
+stream/S
+strict
+strike
+string/GS
+strip
+stripped
+stripping
+strlen
+strong
+strtod
+strtol
+struct/I
+structure/S
+strung
+stuff
+stumbling
+style/S
+su
+sub
+subdirectory
+subject
+sublicense
+submit
+submitted
+subsequent
+substance
+substantial
+substation
+substitute
+subtree
+subunit
+successfully
+successor
+such
+sufficient
+suffix/S
+sug
+suggest/SDG
+suggestion/S
+suit
+suitable
+suite
+summarize/D
+superior
+superset
+supply/D
+support/DS
+supported/U
+suppose/D
+suprised
+sure
+surrender
+surround/D
+swapped
+swaps
+switch/DG
+syllabary/S
+syllable
+symbol/S
+symbolic
+syntax
+system/S
+ta
+tab/S
+table/S
+taff
+tag/S
+tailored
+take/SG
+taken
+tar
+tarbar
+target
+task/S
+te
+technical
+technique
+tedious
+teh
+tell/S
+templates
+temporarily
+temporary
+ten
+tends
+term/S
+terminal
+terminate/D
+terse
+test/DSG
+tet
+tex
+texi
+texinfo
+text/S
+textbook
+textual
+than
+thanks
+that
+the/G
+their
+them
+themselves
+then
+there
+therefore
+therein
+these
+they
+thing/S
+think/S
+third
+this
+thoroughly
+those
+though
+thought
+thousand
+thread/DS
+threat
+three
+threshold
+through
+throughout
+throws
+thus
+thwart
+ti
+time/S
+tiny
+title/S
+titlepage
+tmac
+to/I
+together
+tokenized
+tokenizer
+tokenizing
+tomatoe
+tone
+too
+tool/S
+top
+topmost
+total/Y
+touch
+tough
+tpi
+track/R
+traditional
+traffic
+trailing
+transferring
+transform/SD
+transformation
+translate/DSGN
+translation/S
+transparent
+treat/SDG
+tree
+trial
+trick
+trigger
+trival
+trouble
+true
+truly
+try/GDS
+tuned
+turn/ADS
+tweak/G
+two
+ty
+type/GRS
+typenames
+typical/Y
+typo/S
+ucla
+ucs
+ug
+uk
+uller
+ultra
+unaltered
+unbearably
+unconditional/Y
+undef
+under
+undergone
+underlying
+underscore/S
+understand/GS
+understood
+unenforceable
+unfortunately
+unicode
+uniform
+union
+unique/Y
+unpack
+unpredictable
+unsafe
+until
+up
+uparrow
+upcoming
+update/GDS
+upon
+uppercase
+ur
+url/S
+us/GDRS
+usable/U
+usage
+use
+used/U
+useful
+usefull
+useless
+user/S
+usr
+usually
+utf
+util/S
+utility
+uz
+valid/I
+validate
+validity
+value/S
+variable/S
+variant/I
+variety/S
+various
+ve
+vector
+verbatim
+verified
+versa
+version/S
+very
+vi
+via
+vice
+view/R
+vimrc
+viscii
+vise
+visible/I
+void
+volume
+voluminous
+vowel/S
+wa/S
+want/DS
+wanted/U
+warning/S
+warranty/S
+waste/DS
+way/S
+we
+weaker
+web
+weeks
+weighed
+weighted
+weights
+well
+went
+were
+wether
+what
+whatever
+whatsoever
+when
+whenever
+where
+whereas
+wherever
+wherewithal
+whether
+which
+while
+white
+whitespace
+who
+whoever
+whole
+whose
+why
+wide/YT
+width
+wiki
+wikipedia
+will/G
+wind
+windows
+wish
+with
+within
+without
+wo
+won
+wonderful
+wondering
+word/S
+wordlist/S
+work/AG
+workaround
+works
+world
+worldlanguage
+worldonline
+worry
+worth
+would
+wouldn
+wrap
+wrapper
+write/RG
+written/A
+wrong
+wrote
+xoom
+year/S
+yet
+yi
+yo
+you
+your
+yourself
+za
+zaimi
+zero
+zu
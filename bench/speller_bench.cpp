@@ -0,0 +1,524 @@
+// This file is part of The New Aspell
+// Copyright (C) 2011 by Kevin Atkinson under the GNU LGPL license
+// version 2.0 or 2.1.  You should have received a copy of the LGPL
+// license along with this library if you did not you can find
+// it at http://www.gnu.org/.
+
+// Benchmark for the speller.  Builds a dictionary in <work dir> from
+// the word list given and then measures:
+//
+//   create.*   the time to build the dictionary
+//   load.*     the time to load the dictionary with and without mmap
+//   check.*    how many words per second can be checked
+//   suggest.*  the latency of finding suggestions for each sug-mode
+//   filter.*   how fast text is checked in the sgml, tex and email modes
+//   convert.*  how fast text is converted to and from the internal
+//              encoding
+//
+// The text checked is made up from the expanded word list with a
+// misspelling every 20 words, and is the same on every run.  The
+// results are written to standard output, one per line, as
+//
+//   <name> TAB <value> TAB <unit>
+//
+// after a line with the format version.  The names and units stay
+// the same from one run to the next so that the output of two runs
+// can be compared line by line.
+//
+// The language data files for the word list, and the data files the
+// filters use, are looked for in <work dir> and then in data-dir.  Any
+// option can be given in the form --<option>=<value> to change how the
+// speller is set up.  "make bench" copies everything that is needed
+// into bench/work, see Makefile.am.
+//
+// usage: speller-bench [--<option>[=<value>] ...] <word list> <work dir>
+//                      [<thousands of words to check>]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+#include "settings.h"
+
+#include "asc_ctype.hpp"
+#include "cache.hpp"
+#include "checker.hpp"
+#include "config.hpp"
+#include "convert.hpp"
+#include "fstream.hpp"
+#include "objstack.hpp"
+#include "speller.hpp"
+#include "stack_ptr.hpp"
+#include "string_enumeration.hpp"
+#include "vector.hpp"
+
+#include "data.hpp"
+#include "lang_impl.hpp"
+#include "stats.hpp"
+
+using namespace aspell;
+using sp::stats_now;
+
+static const char * sug_modes[] = {
+  "ultra", "fast", "normal", "slow", "bad-spellers", 0
+};
+
+static const char * filter_modes[] = {
+  "none", "sgml", "tex", "email", 0
+};
+
+static const unsigned load_reps     = 10;
+static const unsigned check_reps    = 5;
+static const unsigned filter_reps   = 3;
+static const unsigned convert_reps  = 5;
+static const unsigned suggest_words = 200;
+
+static void print_result(const char * name, double value, const char * unit)
+{
+  printf("%s\t%.3f\t%s\n", name, value, unit);
+}
+
+static void print_count(const char * name, unsigned long value, const char * unit)
+{
+  printf("%s\t%lu\t%s\n", name, value, unit);
+}
+
+#define EXIT_ON_ERR(command) \
+  do{PosibErrBase err(command);\
+  if(err.has_err()){fprintf(stderr, "Error: %s\n", err.get_err()->mesg); exit(1);}\
+  } while(false)
+
+//////////////////////////////////////////////////////////////////////
+//
+// The text to check
+//
+
+struct Rand {
+  unsigned seed;
+  Rand() : seed(1) {}
+  unsigned operator() (unsigned n) {
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) % n;
+  }
+};
+
+class LineEnumeration : public StringEnumeration {
+  const Vector<String> * lines;
+  unsigned i;
+public:
+  LineEnumeration(const Vector<String> & l) : lines(&l), i(0) {}
+  StringEnumeration * clone() const {return new LineEnumeration(*this);}
+  void assign(const StringEnumeration * other) {
+    *this = *static_cast<const LineEnumeration *>(other);
+  }
+  const char * next() {
+    if (i == lines->size()) return 0;
+    return (*lines)[i++].str();
+  }
+  bool at_end() const {return i == lines->size();}
+};
+
+static void read_lines(const char * file, Vector<String> & lines)
+{
+  FStream in;
+  EXIT_ON_ERR(in.open(file, "r"));
+  String line;
+  while (in.getline(line)) {
+    if (line.empty() || line[0] == '#') continue;
+    lines.push_back(line);
+  }
+}
+
+// expands the affix flags of each word in the word list
+static void expand_words(Config * config, const Vector<String> & word_list,
+                         Vector<String> & words)
+{
+  sp::find_language(*config);
+  PosibErr<sp::LangImpl *> pe = sp::new_lang_impl(*config);
+  EXIT_ON_ERR(pe);
+  CachePtr<sp::LangImpl> lang;
+  lang.reset(pe.data);
+  ObjStack buf;
+  for (unsigned i = 0; i != word_list.size(); ++i) {
+    String word = word_list[i];
+    String aff;
+    size_t slash = word.find('/');
+    if (slash != String::npos) {
+      aff = word.str() + slash + 1;
+      word.resize(slash);
+    }
+    buf.reset();
+    for (WordAff * p = lang->expand(word, aff, buf); p; p = p->next)
+      words.push_back(p->word.str);
+  }
+}
+
+// makes an unintentional looking spelling mistake
+static String misspell(const String & word, Rand & rand)
+{
+  String res = word;
+  unsigned i = rand(res.size());
+  char c = 'a' + rand(26);
+  switch (rand(4)) {
+  case 0:
+    if (i + 1 < res.size()) std::swap(res[i], res[i+1]);
+    else res += c;
+    break;
+  case 1:
+    if (res.size() > 2) res.erase(i, 1);
+    else res += c;
+    break;
+  case 2:
+    res.insert(i, c);
+    break;
+  case 3:
+    res[i] = res[i] == c ? c + 1 : c;
+    break;
+  }
+  return res;
+}
+
+struct Text {
+  Vector<String> words;       // every word of the text in order
+  Vector<unsigned> line_ends; // index in words of the end of each line
+  Vector<String> misspelled;  // distinct misspelled words
+};
+
+static void make_text(const Vector<String> & vocab, unsigned num_words, Text & text)
+{
+  Rand rand;
+  unsigned line_len = 0;
+  bool sentence_start = true;
+  for (unsigned i = 0; i != num_words; ++i) {
+    String word = vocab[rand(vocab.size())];
+    if (i % 20 == 19) {
+      word = misspell(word, rand);
+      if (text.misspelled.size() < suggest_words
+          && std::find(text.misspelled.begin(), text.misspelled.end(), word)
+             == text.misspelled.end())
+        text.misspelled.push_back(word);
+    }
+    if (sentence_start) word[0] = asc_toupper(word[0]);
+    sentence_start = rand(12) == 0;
+    if (sentence_start) word += '.';
+    text.words.push_back(word);
+    line_len += word.size() + 1;
+    if (line_len > 70) {
+      text.line_ends.push_back(i + 1);
+      line_len = 0;
+    }
+  }
+  if (text.line_ends.empty() || text.line_ends.back() != num_words)
+    text.line_ends.push_back(num_words);
+}
+
+static const char * latin_words[] = {
+  "caf\xc3\xa9", "na\xc3\xafve", "fa\xc3\xa7" "ade", "\xc3\xbc" "ber",
+  "sch\xc3\xb6n", "ni\xc3\xb1o", "se\xc3\xb1or", "d\xc3\xa9j\xc3\xa0", 0
+};
+
+// Writes out the text one line per string, marked up for the given
+// filter mode.  If latin is true every 8th word is replaced with one
+// with accented letters.
+static void format_text(const Text & text, const char * mode, bool latin,
+                        Vector<String> & lines)
+{
+  unsigned num_latin = 0;
+  while (latin_words[num_latin]) ++num_latin;
+  bool sgml = strcmp(mode, "sgml") == 0;
+  bool tex  = strcmp(mode, "tex") == 0;
+  bool email = strcmp(mode, "email") == 0;
+  unsigned w = 0;
+  for (unsigned l = 0; l != text.line_ends.size(); ++l) {
+    String line;
+    if (sgml) line += "<p class=\"text\">";
+    if (tex && l % 10 == 0) line += "\\section{";
+    if (email && l % 3 != 0) line += l % 9 == 1 ? ">> " : "> ";
+    for (bool first = true; w != text.line_ends[l]; ++w, first = false) {
+      const char * word = text.words[w].str();
+      if (latin && w % 8 == 7) word = latin_words[w / 8 % num_latin];
+      if (!first) line += ' ';
+      if (sgml && w % 11 == 5) {
+        line += "<a href=\"http://example.com/";
+        line += word;
+        line += "\">";
+        line += word;
+        line += "</a>";
+      } else if (sgml && w % 7 == 3) {
+        line += "<em>";
+        line += word;
+        line += "</em>";
+      } else if (tex && w % 13 == 6) {
+        line += "$x_{";
+        line += word;
+        line += "}$";
+      } else if (tex && w % 7 == 3) {
+        line += "\\emph{";
+        line += word;
+        line += "}";
+      } else {
+        line += word;
+      }
+    }
+    if (sgml) line += "</p>";
+    if (tex && l % 10 == 0) line += "}";
+    if (tex && l % 8 == 4) line += " % a comment";
+    line += '\n';
+    lines.push_back(line);
+  }
+}
+
+static double text_size(const Vector<String> & lines)
+{
+  double size = 0;
+  for (unsigned i = 0; i != lines.size(); ++i)
+    size += lines[i].size();
+  return size;
+}
+
+//////////////////////////////////////////////////////////////////////
+//
+// The benchmarks
+//
+
+static double median(Vector<double> & v)
+{
+  std::sort(v.begin(), v.end());
+  return v[v.size() / 2];
+}
+
+// the nearest rank percentile of the sorted values in v
+static double percentile(const Vector<double> & v, double p)
+{
+  unsigned i = (unsigned)(p / 100 * v.size() + 0.999999);
+  return v[i == 0 ? 0 : i - 1];
+}
+
+static Speller * make_speller(Config * config)
+{
+  PosibErr<Speller *> pe = new_speller(config);
+  EXIT_ON_ERR(pe);
+  return pe.data;
+}
+
+static void bench_create(Config * config, const Vector<String> & word_list)
+{
+  sp::find_language(*config);
+  double start = stats_now();
+  EXIT_ON_ERR(sp::create_default_readonly_dict(new LineEnumeration(word_list),
+                                               *config));
+  print_result("create.time", (stats_now() - start) * 1000, "ms");
+}
+
+static void bench_load(Config * config)
+{
+  static const struct {const char * name; const char * value;} kinds[] = {
+    {"load.mmap", "true"},
+    {"load.read", "false"}
+  };
+  // load everything else once so only the dictionary is timed
+  delete make_speller(config);
+  for (unsigned k = 0; k != 2; ++k) {
+    EXIT_ON_ERR(config->replace("use-mmap", kinds[k].value));
+    Vector<double> times;
+    for (unsigned r = 0; r != load_reps; ++r) {
+      reset_cache("dictionary");
+      double start = stats_now();
+      Speller * speller = make_speller(config);
+      times.push_back((stats_now() - start) * 1000);
+      delete speller;
+    }
+    print_result(kinds[k].name, median(times), "ms");
+  }
+  EXIT_ON_ERR(config->replace("use-mmap", "true"));
+}
+
+static void bench_check(Config * config, const Text & text)
+{
+  StackPtr<Speller> speller(make_speller(config));
+  unsigned long misspelled = 0;
+  Vector<double> times;
+  for (unsigned r = 0; r != check_reps; ++r) {
+    misspelled = 0;
+    double start = stats_now();
+    for (unsigned i = 0; i != text.words.size(); ++i) {
+      String word = text.words[i];
+      if (word.back() == '.') word.pop_back();
+      if (!speller->check(MutableString(word.mstr(), word.size())).data)
+        ++misspelled;
+    }
+    times.push_back(stats_now() - start);
+  }
+  print_count("check.words", text.words.size(), "words");
+  print_count("check.misspelled", misspelled, "words");
+  print_result("check.rate", text.words.size() / median(times) / 1000, "kwords/s");
+}
+
+static void bench_suggest(Config * config, const Text & text)
+{
+  print_count("suggest.words", text.misspelled.size(), "words");
+  for (const char * * mode = sug_modes; *mode; ++mode) {
+    EXIT_ON_ERR(config->replace("sug-mode", *mode));
+    StackPtr<Speller> speller(make_speller(config));
+    Vector<double> times;
+    double total = 0;
+    for (unsigned i = 0; i != text.misspelled.size(); ++i) {
+      String word = text.misspelled[i];
+      double start = stats_now();
+      EXIT_ON_ERR(speller->suggest(MutableString(word.mstr(), word.size())));
+      double t = (stats_now() - start) * 1e6;
+      times.push_back(t);
+      total += t;
+    }
+    std::sort(times.begin(), times.end());
+    String name;
+    static const struct {const char * name; double p;} pcts[] = {
+      {"p50", 50}, {"p90", 90}, {"p99", 99}, {"max", 100}
+    };
+    for (unsigned p = 0; p != 4; ++p) {
+      name.clear();
+      name << "suggest." << *mode << "." << pcts[p].name;
+      print_result(name.str(), percentile(times, pcts[p].p), "us");
+    }
+    name.clear();
+    name << "suggest." << *mode << ".mean";
+    print_result(name.str(), total / times.size(), "us");
+  }
+  EXIT_ON_ERR(config->replace("sug-mode", "normal"));
+}
+
+static PosibErr<Checker *> make_checker(Config * config, const char * mode,
+                                        StackPtr<Speller> & speller)
+{
+  RET_ON_ERR(config->replace("mode", mode));
+  RET_ON_ERR_SET(new_speller(config), Speller *, sp);
+  speller.reset(sp);
+  return new_checker(speller);
+}
+
+static void bench_filter(Config * config, const Text & text)
+{
+  for (const char * * mode = filter_modes; *mode; ++mode) {
+    String name;
+    name << "filter." << *mode << ".rate";
+    StackPtr<Speller> speller;
+    PosibErr<Checker *> res = make_checker(config, *mode, speller);
+    if (res.has_err()) {
+      // most likely the filters are not installed
+      fprintf(stderr, "Skipping the %s filter: %s\n", *mode, res.get_err()->mesg);
+      print_result(name.str(), 0, "MB/s");
+      continue;
+    }
+    StackPtr<Checker> checker(res.data);
+    Vector<String> lines;
+    format_text(text, *mode, false, lines);
+    Vector<double> times;
+    for (unsigned r = 0; r != filter_reps; ++r) {
+      checker->reset();
+      double start = stats_now();
+      for (unsigned i = 0; i != lines.size(); ++i) {
+        checker->process(lines[i].str(), lines[i].size());
+        while (checker->next());
+      }
+      times.push_back(stats_now() - start);
+    }
+    print_result(name.str(), text_size(lines) / median(times) / (1024*1024), "MB/s");
+  }
+}
+
+static void bench_convert(Config * config, const Text & text)
+{
+  static const struct {const char * name; const char * from; const char * to;
+                       bool latin;} convs[] = {
+    {"convert.ascii.to-internal",   "utf-8",      "iso-8859-1", false},
+    {"convert.ascii.from-internal", "iso-8859-1", "utf-8",      false},
+    {"convert.latin.to-internal",   "utf-8",      "iso-8859-1", true},
+    {"convert.latin.from-internal", "iso-8859-1", "utf-8",      true},
+    {0, 0, 0, false}
+  };
+  for (unsigned c = 0; convs[c].name; ++c) {
+    Vector<String> lines;
+    format_text(text, "none", convs[c].latin, lines);
+    if (strcmp(convs[c].from, "utf-8") != 0) {
+      // the text is in UTF-8 so convert it first
+      PosibErr<FullConvert *> pe = new_full_convert(*config, "utf-8", convs[c].from, NormNone);
+      EXIT_ON_ERR(pe);
+      StackPtr<FullConvert> to(pe.data);
+      CharVector buf;
+      for (unsigned i = 0; i != lines.size(); ++i) {
+        buf.clear();
+        to->convert(lines[i].str(), lines[i].size(), buf);
+        lines[i].assign(buf.data(), buf.size());
+      }
+    }
+    PosibErr<FullConvert *> pe = new_full_convert(*config, convs[c].from, convs[c].to, NormNone);
+    EXIT_ON_ERR(pe);
+    StackPtr<FullConvert> conv(pe.data);
+    CharVector out;
+    Vector<double> times;
+    for (unsigned r = 0; r != convert_reps; ++r) {
+      double start = stats_now();
+      for (unsigned i = 0; i != lines.size(); ++i) {
+        out.clear();
+        conv->convert(lines[i].str(), lines[i].size(), out);
+      }
+      times.push_back(stats_now() - start);
+    }
+    print_result(convs[c].name, text_size(lines) / median(times) / (1024*1024), "MB/s");
+  }
+}
+
+int main(int argc, const char * argv[])
+{
+  StackPtr<Config> config(new_config());
+  int i = 1;
+  for (; i < argc && strncmp(argv[i], "--", 2) == 0; ++i) {
+    const char * eq = strchr(argv[i], '=');
+    String key = eq ? String(argv[i] + 2, eq - argv[i] - 2) : String(argv[i] + 2);
+    const char * value = eq ? eq + 1 : strncmp(key.str(), "dont-", 5) == 0 ? "" : "true";
+    EXIT_ON_ERR(config->replace(key, value));
+  }
+  if (argc - i < 2) {
+    fprintf(stderr, "usage: speller-bench [--<option>[=<value>] ...] "
+            "<word list> <work dir> [<thousands of words to check>]\n");
+    return 1;
+  }
+  String word_list_file = argv[i];
+  String work_dir = argv[i + 1];
+  if (work_dir[0] != '/') {
+    // a relative dict-dir is taken to be relative to itself when
+    // the dictionary is loaded
+    char cwd[1024];
+    if (getcwd(cwd, sizeof(cwd))) work_dir = String(cwd) + "/" + work_dir;
+  }
+  unsigned num_words = 1000 * (argc - i > 2 ? atoi(argv[i + 2]) : 200);
+
+  if (!config->have("lang"))
+    EXIT_ON_ERR(config->replace("lang", "bench"));
+  EXIT_ON_ERR(config->replace("dict-dir", work_dir));
+  EXIT_ON_ERR(config->replace("master", "bench.rws"));
+  EXIT_ON_ERR(config->replace("encoding", "utf-8"));
+  EXIT_ON_ERR(config->replace("use-other-dicts", "false"));
+  EXIT_ON_ERR(config->replace("sug-cache-size", "0"));
+
+  Vector<String> word_list;
+  read_lines(word_list_file.str(), word_list);
+  Vector<String> vocab;
+  expand_words(config, word_list, vocab);
+  Text text;
+  make_text(vocab, num_words, text);
+
+  printf("# aspell-bench 1\n");
+  print_count("dict.roots", word_list.size(), "words");
+  print_count("dict.words", vocab.size(), "words");
+  bench_create(config, word_list);
+  bench_load(config);
+  bench_check(config, text);
+  bench_suggest(config, text);
+  bench_filter(config, text);
+  bench_convert(config, text);
+  return 0;
+}
@@ -0,0 +1,94 @@
+// This file is part of The New Aspell
+// Copyright (C) 2011 by Kevin Atkinson under the GNU LGPL license
+// version 2.0 or 2.1.  You should have received a copy of the LGPL
+// license along with this library if you did not you can find
+// it at http://www.gnu.org/.
+
+#ifndef ASPELL_ATOMIC__HPP
+#define ASPELL_ATOMIC__HPP
+
+#include "settings.h"
+
+#ifndef HAVE_ATOMIC_BUILTINS
+#  include "lock.hpp"
+#endif
+
+// Atomic operations on ints and pointers.  All of them act as a full
+// memory barrier.  When the compiler does not provide atomic builtins
+// a single global mutex is used instead, which is correct but slow.
+
+namespace aspell {
+
+#ifdef HAVE_ATOMIC_BUILTINS
+
+  // returns the new value
+  static inline int atomic_inc(volatile int & v)
+    {return __atomic_add_fetch(&v, 1, __ATOMIC_SEQ_CST);}
+  static inline int atomic_dec(volatile int & v)
+    {return __atomic_sub_fetch(&v, 1, __ATOMIC_SEQ_CST);}
+
+  // sets v to new_v only if it equals old_v, returns true if it did
+  static inline bool atomic_cas(volatile int & v, int old_v, int new_v)
+    {return __atomic_compare_exchange_n(&v, &old_v, new_v, false, 
+                                        __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);}
+
+  static inline int atomic_load(const volatile int & v)
+    {return __atomic_load_n(&v, __ATOMIC_SEQ_CST);}
+  static inline void atomic_store(volatile int & v, int new_v)
+    {__atomic_store_n(&v, new_v, __ATOMIC_SEQ_CST);}
+
+  template <typename T>
+  static inline T * atomic_load(T * const volatile & p)
+    {return __atomic_load_n(&p, __ATOMIC_SEQ_CST);}
+  template <typename T>
+  static inline void atomic_store(T * volatile & p, T * new_p)
+    {__atomic_store_n(&p, new_p, __ATOMIC_SEQ_CST);}
+
+  // for counters, returns the new value
+  static inline unsigned long atomic_add(volatile unsigned long & v, unsigned long n)
+    {return __atomic_add_fetch(&v, n, __ATOMIC_SEQ_CST);}
+  static inline unsigned long atomic_load(const volatile unsigned long & v)
+    {return __atomic_load_n(&v, __ATOMIC_SEQ_CST);}
+  static inline void atomic_store(volatile unsigned long & v, unsigned long new_v)
+    {__atomic_store_n(&v, new_v, __ATOMIC_SEQ_CST);}
+
+#else
+
+  extern Mutex atomic_fallback_lock; // defined in cache.cpp
+
+  static inline int atomic_inc(volatile int & v)
+    {LOCK(&atomic_fallback_lock); return ++v;}
+  static inline int atomic_dec(volatile int & v)
+    {LOCK(&atomic_fallback_lock); return --v;}
+
+  static inline bool atomic_cas(volatile int & v, int old_v, int new_v) {
+    LOCK(&atomic_fallback_lock);
+    if (v != old_v) return false;
+    v = new_v;
+    return true;
+  }
+
+  static inline int atomic_load(const volatile int & v)
+    {LOCK(&atomic_fallback_lock); return v;}
+  static inline void atomic_store(volatile int & v, int new_v)
+    {LOCK(&atomic_fallback_lock); v = new_v;}
+
+  template <typename T>
+  static inline T * atomic_load(T * const volatile & p)
+    {LOCK(&atomic_fallback_lock); return p;}
+  template <typename T>
+  static inline void atomic_store(T * volatile & p, T * new_p)
+    {LOCK(&atomic_fallback_lock); p = new_p;}
+
+  static inline unsigned long atomic_add(volatile unsigned long & v, unsigned long n)
+    {LOCK(&atomic_fallback_lock); return v += n;}
+  static inline unsigned long atomic_load(const volatile unsigned long & v)
+    {LOCK(&atomic_fallback_lock); return v;}
+  static inline void atomic_store(volatile unsigned long & v, unsigned long new_v)
+    {LOCK(&atomic_fallback_lock); v = new_v;}
+
+#endif
+
+}
+
+#endif
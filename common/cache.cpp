@@ -1,65 +1,98 @@
 #include <assert.h>
 
+#include "settings.h"
+
+#ifdef USE_POSIX_MUTEX
+#  include <sched.h>
+#endif
+
 #include "stack_ptr.hpp"
 #include "cache.hpp"
 
 namespace aspell {
 
+#ifndef HAVE_ATOMIC_BUILTINS
+Mutex atomic_fallback_lock;
+#endif
+
 static StackPtr<Mutex> global_cache_lock(new Mutex);
 static GlobalCacheBase * first_cache = 0;
 
-void Cacheable::copy() const
-{
-  //CERR << "COPY\n";
-  LOCK(&cache->lock);
-  copy_no_lock();
-}
-
+// n->next is left alone so that a search which is at n can still get
+// to the rest of the list
 void GlobalCacheBase::del(Cacheable * n)
 {
-  *n->prev = n->next;
+  atomic_store(*n->prev, n->next);
   if (n->next) n->next->prev = n->prev;
-  n->next = 0;
   n->prev = 0;
 }
 
-void GlobalCacheBase::add(Cacheable * n) 
+void GlobalCacheBase::add(Cacheable * n, unsigned long hash) 
 {
   assert(n->refcount > 0);
+  Cacheable * volatile & first = buckets[hash % num_buckets];
   n->next = first;
   n->prev = &first;
   if (first) first->prev = &n->next;
-  first = n;
   n->cache = this;
+  atomic_store(first, n);
+}
+
+// Waits until every search which might have seen an item removed
+// before the call is finished.  New searches are counted in the
+// other half of readers so this does not wait on them.  It must not
+// be called with the lock held.
+void GlobalCacheBase::synchronize()
+{
+  LOCK(&sync_lock);
+  int old = atomic_load(epoch);
+  atomic_store(epoch, !old);
+  while (atomic_load(readers[old]) != 0) {
+#ifdef USE_POSIX_MUTEX
+    sched_yield();
+#endif
+  }
 }
 
 void GlobalCacheBase::release(Cacheable * d) 
 {
   //CERR << "RELEASE\n";
-  LOCK(&lock);
-  d->refcount--;
-  assert(d->refcount >= 0);
-  if (d->refcount != 0) return;
+  int c = atomic_dec(d->refcount);
+  assert(c >= 0);
+  if (c != 0) return;
   //CERR << "DEL\n";
-  if (d->attached()) del(d);
+  bool was_attached;
+  {
+    LOCK(&lock);
+    was_attached = d->attached();
+    if (was_attached) del(d);
+  }
+  if (was_attached) synchronize();
   delete d;
 }
 
 void GlobalCacheBase::detach(Cacheable * d)
 {
-  LOCK(&lock);
-  if (d->attached()) del(d);
+  {
+    LOCK(&lock);
+    if (!d->attached()) return;
+    del(d);
+  }
+  synchronize();
 }
 
 void GlobalCacheBase::detach_all()
 {
-  LOCK(&lock);
-  Cacheable * p = first;
-  while (p) {
-    *p->prev = 0;
-    p->prev = 0;
-    p = p->next;
+  {
+    LOCK(&lock);
+    for (unsigned i = 0; i != num_buckets; ++i) {
+      Cacheable * p = buckets[i];
+      atomic_store(buckets[i], (Cacheable *)0);
+      for (; p; p = p->next)
+        p->prev = 0;
+    }
   }
+  synchronize();
 }
 
 void release_cache_data(GlobalCacheBase * cache, const Cacheable * d)
@@ -68,8 +101,11 @@ void release_cache_data(GlobalCacheBase * cache, const Cacheable * d)
 }
 
 GlobalCacheBase::GlobalCacheBase(const char * n)
-  : name (n)
+  : name (n), epoch(0)
 {
+  for (unsigned i = 0; i != num_buckets; ++i)
+    buckets[i] = 0;
+  readers[0] = readers[1] = 0;
   LOCK(global_cache_lock);
   next = first_cache;
   prev = &first_cache;
@@ -1,13 +1,24 @@
 #ifndef ACOMMON_CACHE__HPP
 #define ACOMMON_CACHE__HPP
 
+#include "atomic.hpp"
+#include "hash_fun.hpp"
 #include "lock.hpp"
+#include "parm_string.hpp"
 #include "posib_err.hpp"
 
 namespace aspell {
 
 class Cacheable;
 
+// Searching the cache does not acquire the lock.  Each search counts
+// itself in readers[epoch] while it is running.  An item removed
+// from the cache is not deleted until every search that might have
+// seen it is finished (see synchronize), so a search never touches
+// freed memory.  Anything that changes the cache must hold the lock,
+// but the waiting is done after it is released so that other users of
+// the cache are not held up by a slow search.
+
 class GlobalCacheBase
 {
 public:
@@ -17,17 +28,47 @@ public: // but don't use
   GlobalCacheBase * next;
   GlobalCacheBase * * prev;
 protected:
-  Cacheable * first;
+  static const unsigned int num_buckets = 64;
+  Cacheable * volatile buckets[num_buckets];
+  mutable volatile int readers[2];
+  mutable volatile int epoch;
+  Mutex sync_lock; // only one synchronize at a time
   void del(Cacheable * d);
-  void add(Cacheable * n);
+  void add(Cacheable * n, unsigned long hash);
+  void synchronize();
   GlobalCacheBase(const char * n);
   ~GlobalCacheBase();
+  class ReadLock {
+    volatile int * count;
+  public:
+    ReadLock(const GlobalCacheBase * c) {
+      // if the epoch changed before the search was counted a
+      // synchronize may already be waiting on the other half, so
+      // count it again
+      for (;;) {
+        int e = atomic_load(c->epoch);
+        count = &c->readers[e];
+        atomic_inc(*count);
+        if (atomic_load(c->epoch) == e) break;
+        atomic_dec(*count);
+      }
+    }
+    ~ReadLock() {atomic_dec(*count);}
+  };
 public:
   void release(Cacheable * d);
   void detach(Cacheable * d);
   void detach_all();
 };
 
+// The hash for a cache key, it must be the same for any two keys that
+// cache_key_eq considers equal.  Other key types provide their own
+// overload.
+static inline unsigned long cache_key_hash(ParmString key) 
+{
+  return hash<const char *>()(key);
+}
+
 template <class D>
 class GlobalCache : public GlobalCacheBase
 {
@@ -36,41 +77,39 @@ public:
   typedef typename Data::CacheKey Key;
 public:
   GlobalCache(const char * n) : GlobalCacheBase(n) {}
-  // "find" and "add" will _not_ acquire a lock
-  Data * find(const Key & key) {
-    D * cur = static_cast<D *>(first);
-    while (cur && !cur->cache_key_eq(key))
-      cur = static_cast<D *>(cur->next);
-    return cur;
+  // "find" will _not_ acquire a lock, if found the refcount is
+  // incremented
+  Data * find(const Key & key);
+  // "add" will _not_ acquire a lock, the caller must hold it
+  void add(Data * n, const Key & key) {
+    GlobalCacheBase::add(n, cache_key_hash(key));
   }
-  void add(Data * n) {GlobalCacheBase::add(n);}
   // "release" and "detach" _will_ acquire a lock
   void release(Data * d) {GlobalCacheBase::release(d);}
   void detach(Data * d) {GlobalCacheBase::detach(d);}
 };
 
-// get_cache_data (both versions) and release_cache_data will acquires
-// the cache's lock
+// get_cache_data (both versions) will only acquire the cache's lock
+// if the data is not already in the cache
 
 template <class Data>
 PosibErr<Data *> get_cache_data(GlobalCache<Data> * cache, 
                                 const typename Data::CacheConfig * config, 
                                 const typename Data::CacheKey & key)
 {
-  LOCK(&cache->lock);
   Data * n = cache->find(key);
+  if (n) return n;
+  LOCK(&cache->lock);
+  n = cache->find(key); // it may have been added while waiting for the lock
   //CERR << "Getting " << key << " for " << cache->name << "\n";
-  if (n) {
-    n->refcount++;
-    return n;
-  }
+  if (n) return n;
   PosibErr<Data *> res = Data::get_new(key, config);
   if (res.has_err()) {
     //CERR << "ERROR\n"; 
     return res;
   }
   n = res.data;
-  cache->add(n);
+  cache->add(n, key);
   //CERR << "LOADED FROM DISK\n";
   return n;
 }
@@ -81,20 +120,19 @@ PosibErr<Data *> get_cache_data(GlobalCache<Data> * cache,
                                 const typename Data::CacheConfig2 * config2,
                                 const typename Data::CacheKey & key)
 {
-  LOCK(&cache->lock);
   Data * n = cache->find(key);
+  if (n) return n;
+  LOCK(&cache->lock);
+  n = cache->find(key); // it may have been added while waiting for the lock
   //CERR << "Getting " << key << "\n";
-  if (n) {
-    n->refcount++;
-    return n;
-  }
+  if (n) return n;
   PosibErr<Data *> res = Data::get_new(key, config, config2);
   if (res.has_err()) {
     //CERR << "ERROR\n"; 
     return res;
   }
   n = res.data;
-  cache->add(n);
+  cache->add(n, key);
   //CERR << "LOADED FROM DISK\n";
   return n;
 }
@@ -108,19 +146,40 @@ static inline void release_cache_data(const GlobalCacheBase * c, const Cacheable
 class Cacheable
 {
 public: // but don't use
-  Cacheable * next;
-  Cacheable * * prev;
-  mutable int refcount;
+  Cacheable * volatile next;
+  Cacheable * volatile * prev;
+  mutable volatile int refcount;
   GlobalCacheBase * cache;
+  // increments the refcount unless it already dropped to zero, in
+  // which case the object is about to be deleted
+  bool copy_if_alive() const {
+    for (;;) {
+      int c = atomic_load(refcount);
+      if (c == 0) return false;
+      if (atomic_cas(refcount, c, c + 1)) return true;
+    }
+  }
 public:
   bool attached() {return prev;}
-  void copy_no_lock() const {refcount++;}
-  void copy() const; // Acquires cache->lock
-  void release() const {release_cache_data(cache,this);} // Acquires cache->lock
+  void copy_no_lock() const {atomic_inc(refcount);}
+  void copy() const {atomic_inc(refcount);}
+  void release() const {release_cache_data(cache,this);} // May acquire cache->lock
   Cacheable(GlobalCacheBase * c = 0) : next(0), prev(0), refcount(1), cache(c) {}
   virtual ~Cacheable() {}
 };
 
+template <class D>
+D * GlobalCache<D>::find(const Key & key)
+{
+  ReadLock r(this);
+  Cacheable * cur = atomic_load(buckets[cache_key_hash(key) % num_buckets]);
+  for (; cur; cur = atomic_load(cur->next)) {
+    D * d = static_cast<D *>(cur);
+    if (d->cache_key_eq(key) && d->copy_if_alive()) return d;
+  }
+  return 0;
+}
+
 template <class Data>
 class CachePtr
 {
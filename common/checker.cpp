@@ -4,6 +4,8 @@
  * LGPL license along with this library if you did not you can find it
  * at http://www.gnu.org/.                                              */
 
+#include <string.h>
+
 #include "checker.hpp"
 #include "convert.hpp"
 #include "speller.hpp"
@@ -12,7 +14,8 @@
 namespace aspell {
 
   Checker::Checker() 
-    : more_data_callback_(0), string_freed_callback_(0), 
+    : check_words_(true),
+      more_data_callback_(0), string_freed_callback_(0), 
       last_id(0), span_strings_(false), first(0), last(0)
   {
   }
@@ -49,6 +52,28 @@ namespace aspell {
   void Checker::init(Speller * speller)
   {
     conv_ = speller->to_internal_;
+
+    // Find the bytes which the conversion leaves unchanged.  When the
+    // document is in a multibyte encoding only ASCII characters are
+    // considered.  Characters from U+0300 on are never used as they
+    // may combine with the previous character when normalizing.
+    const char * in_code = conv_->in_code();
+    bool ucs  = strncmp(in_code, "ucs-", 4) == 0;
+    bool utf8 = strncmp(in_code, "utf-8", 5) == 0;
+    FilterCharVector decoded, encoded;
+    raw_chars_[0] = false;
+    for (unsigned i = 1; i != 256; ++i) {
+      raw_chars_[i] = false;
+      if (ucs || (utf8 && i >= 0x80)) continue;
+      char c = static_cast<char>(i);
+      decoded.clear();
+      conv_->decode(&c, 1, decoded);
+      if (decoded.size() != 1 || decoded[0].width != 1 
+          || decoded[0].chr >= 0x300) continue;
+      encoded.clear();
+      conv_->encode(decoded.pbegin(), decoded.pend(), encoded);
+      raw_chars_[i] = encoded.size() == 1 && encoded[0].chr == i;
+    }
   }
 
   const FilterChar SegmentIterator::empty_str[1] = {FilterChar(0,0)};
@@ -89,11 +114,58 @@ namespace aspell {
     return seg;
   }
 
+  // The string can be used as is if there are no filters and every
+  // byte is a character which the conversion leaves unchanged
+  bool Checker::can_use_raw(const char * str, unsigned size) const
+  {
+    if (!filter_ || !filter_->empty()) return false;
+    const char * end = str + size;
+    for (; str != end; ++str)
+      if (!raw_chars_[static_cast<unsigned char>(*str)]) return false;
+    return true;
+  }
+
+  Segment * Checker::fill_raw_segment(const char * str, unsigned size)
+  {
+    SegmentData * buf = new SegmentData;
+    buf->raw.append(str, size);
+    buf->raw.append('\0');
+    Segment * seg = new Segment;
+    seg->raw_begin = buf->raw.pbegin();
+    seg->raw_end = buf->raw.pend();
+    seg->offset = 0;
+    seg->data = buf;
+    return seg;
+  }
+
+  // converts a raw segment into a normal one
+  void Checker::widen(Segment * seg)
+  {
+    SegmentData & buf = *seg->data;
+    buf.clear();
+    for (const char * i = seg->raw_begin; i != seg->raw_end; ++i)
+      buf.push_back(FilterChar(static_cast<unsigned char>(*i)));
+    seg->begin = buf.pbegin();
+    seg->end = buf.pend();
+    seg->raw_begin = 0;
+    seg->raw_end = 0;
+  }
+
+  void Checker::widen(IToken::Pos & p)
+  {
+    if (!p.raw_pos) return;
+    if (p.seg->raw_begin) widen(p.seg);
+    p.pos = p.seg->begin + (p.raw_pos - p.seg->data->raw.pbegin());
+    p.raw_pos = 0;
+  }
+
   void Checker::process(const char * str, 
                         unsigned size, unsigned ignore, 
                         void * which)
   {
-    Segment * seg = fill_segment(0, str, size, filter_);
+    Segment * seg = (can_use_raw(str, size) 
+                     ? fill_raw_segment(str, size)
+                     : fill_segment(0, str, size, filter_));
     seg->ignore = ignore;
     seg->which = which;
     seg->id = last_id++;
@@ -119,6 +191,8 @@ namespace aspell {
 
   void Checker::replace(const char * str, unsigned size)
   {
+    widen(token.b);
+    widen(token.e);
     Segment * seg = 0;
     if (token.b.seg == token.e.seg &&
         token.b.pos == token.b.seg->begin && token.e.pos == token.e.seg->end)
@@ -173,11 +247,13 @@ namespace aspell {
     if (!seg->next) c->need_more(seg);
     seg = seg->next;
     if (seg) {
-      pos = seg->begin;
+      pos = seg->raw_begin ? empty_str : seg->begin;
+      raw_pos = seg->raw_begin;
       offset = seg->offset;
       return true;
     } else {
       pos = empty_str;
+      raw_pos = 0;
       offset = 0;
       return false;
     }
@@ -22,6 +22,7 @@ namespace aspell {
   class FullConvert;
 
   struct SegmentData : public FilterCharVector {
+    CharVector raw; // used instead for raw segments
     mutable int refcount;
     SegmentData() : refcount(0) {}
   };
@@ -65,6 +66,12 @@ namespace aspell {
     // the last character of the string ie *(end-1) == '\0';
     const FilterChar * begin;
     const FilterChar * end;
+    // If the string did not need any conversion or filtering it is
+    // kept as is and each byte is a character with a width of one.
+    // In that case raw_begin is non-null and begin and end are not
+    // used.  The same is true for the null character.
+    const char * raw_begin;
+    const char * raw_end;
     Segment * prev;
     Segment * next;
     
@@ -74,7 +81,8 @@ namespace aspell {
     unsigned ignore; // don't spellchecker up to ignore
     
     SegmentDataPtr data;
-    Segment() : begin(0), end(0), prev(0), next(0), 
+    Segment() : begin(0), end(0), raw_begin(0), raw_end(0), 
+                prev(0), next(0), 
                 which(0), id(0), offset(0), ignore(0) {}
   };
 
@@ -86,6 +94,7 @@ namespace aspell {
       struct Pos {
         Segment * seg;
         const FilterChar * pos;
+        const char * raw_pos;
       };
       Pos b; // begin
       Pos e; // end
@@ -97,6 +106,8 @@ namespace aspell {
     
     IToken token;
 
+    bool check_words_;
+
     void free_segments(Segment * f = 0, Segment * l = 0); 
     // free all segments between f and l, but not including f and l
     // if f and l is null than free all segments
@@ -192,6 +203,15 @@ namespace aspell {
     // if a word can span multiple strings in the case when word has a
     // space in it or the like.  This defaults to false.
 
+    void set_check_words(bool v) {check_words_ = v;}
+    // if words are checked as they are found.  When false "correct"
+    // is always false and the word, in the internal encoding, is
+    // available via "cur_word" until the next call to "next" so
+    // that it can be checked later, possibly in another thread.
+    // This defaults to true.
+
+    virtual const char * cur_word() const = 0;
+
     // Should I add these?
     //PosibErr<void> add_to_personal();
     //PosibErr<void> add_lower_to_personal();
@@ -207,6 +227,11 @@ namespace aspell {
                            const char * str, unsigned size, 
                            Filter * filter);
 
+    bool can_use_raw(const char * str, unsigned size) const;
+    Segment * fill_raw_segment(const char * str, unsigned size);
+    void widen(Segment * seg);
+    void widen(IToken::Pos & p);
+
     void (* more_data_callback_)(void *, void *);
     void * more_data_callback_data_;
 
@@ -214,6 +239,7 @@ namespace aspell {
     void * string_freed_callback_data_;
 
     FullConvert * conv_;
+    bool raw_chars_[256]; // bytes which do not need converting
     CopyPtr<Filter> filter_;
     FilterCharVector proc_str_;
     unsigned last_id;
@@ -226,21 +252,37 @@ namespace aspell {
     static const FilterChar empty_str[1];
     Segment    * seg;
     const FilterChar * pos;
+    const char * raw_pos; // used instead of pos for raw segments
     unsigned        offset;
     SegmentIterator()
-      : seg(0), pos(empty_str), offset(0) {}
+      : seg(0), pos(empty_str), raw_pos(0), offset(0) {}
     void clear()
-      {seg = 0; pos = empty_str; offset = 0;}
+      {seg = 0; pos = empty_str; raw_pos = 0; offset = 0;}
     SegmentIterator(Segment * s) 
-      : seg(s), pos(s->begin), offset(s->offset) {}
-    void operator= (Segment * s) 
-      {seg = s; pos = s->begin; offset = s->offset;}
-    const FilterChar & operator*() const {return *pos;}
+      {operator=(s);}
+    void operator= (Segment * s) {
+      seg = s; 
+      pos = s->raw_begin ? empty_str : s->begin; 
+      raw_pos = s->raw_begin;
+      offset = s->offset;
+    }
+    FilterChar operator*() const {
+      if (raw_pos) return FilterChar(static_cast<unsigned char>(*raw_pos));
+      return *pos;
+    }
     bool off_end() const {return seg == 0;}
+    bool at_seg_end() const 
+      {return raw_pos ? raw_pos == seg->raw_end : pos == seg->end;}
     void init(Checker * c)
-      {if (seg && pos == seg->end) adv_seg(c);}
+      {if (seg && at_seg_end()) adv_seg(c);}
     bool adv(Checker * c) {
       if (!seg) return false;
+      if (raw_pos) {
+        offset++;
+        raw_pos++;
+        if (raw_pos == seg->raw_end) return adv_seg(c);
+        return true;
+      }
       offset += pos->width;
       pos++;
       if (pos == seg->end) return adv_seg(c);
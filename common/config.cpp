@@ -1405,6 +1405,10 @@ namespace aspell {
     // the description should be under 50 chars
     {"actual-dict-dir", KeyInfoString, "<dict-dir^master>", 0}
     , {"actual-lang",     KeyInfoString, "", 0} 
+    , {"affix-cache-size", KeyInfoInt, "4096",
+       N_("number of affix stripping results to cache")}
+    , {"collect-stats", KeyInfoBool, "false",
+       N_("collect statistics on checking and suggesting"), KEYINFO_MAY_CHANGE}
     , {"conf",     KeyInfoString, "aspell.conf",
        /* TRANSLATORS: The remaing strings in config.cpp should be kept
           under 50 characters, begin with a lower case character and not
@@ -1499,6 +1503,8 @@ namespace aspell {
        N_("set the prefix based on executable location")}
     , {"size",          KeyInfoString, "+60",
        N_("size of the word list")}
+    , {"soundslike-cache-size", KeyInfoInt, "65536",
+       N_("number of soundslikes to cache, 0 to disable")}
     , {"spelling",   KeyInfoString, "",
        N_("no longer used"), KEYINFO_HIDDEN}
     , {"sug-mode",   KeyInfoString, "normal",
@@ -1513,6 +1519,14 @@ namespace aspell {
        N_("use replacement tables, override sug-mode default")}
     , {"sug-split-char", KeyInfoList, "\\ :-",
        N_("characters to insert when a word is split"), KEYINFO_UTF8}
+    , {"sug-cache-size", KeyInfoInt, "256",
+       N_("number of words to cache suggestions for, 0 to disable")}
+    , {"sug-threads", KeyInfoInt, "1",
+       N_("threads to use when scanning, 0 for all cpus")}
+    , {"sug-batch-threads", KeyInfoInt, "0",
+       N_("threads to use for a batch of words, 0 for all cpus")}
+    , {"use-mmap", KeyInfoBool, "true",
+       N_("map compiled word lists into memory rather than reading them")}
     , {"use-other-dicts", KeyInfoBool, "true",
        N_("use personal, replacement & session dictionaries")}
     , {"variety", KeyInfoList, "",
@@ -1542,12 +1556,22 @@ namespace aspell {
        N_("remove invalid affix flags")}
     , {"clean-words", KeyInfoBool, "false",
        N_("attempts to clean words so that they are valid")}
+    , {"create-threads", KeyInfoInt, "0",
+       N_("threads to use when creating dictionaries, 0 for all cpus")}
+    , {"deletion-index", KeyInfoBool, "false",
+       N_("add an index for faster suggestions when creating dictionaries")}
+    , {"expanded-index", KeyInfoBool, "false",
+       N_("add an index of the forms with suffixes when creating dictionaries")}
     , {"invisible-soundslike", KeyInfoBool, "false",
        N_("compute soundslike on demand rather than storing")} 
+    , {"lookup-filter", KeyInfoBool, "false",
+       N_("add a filter to reject unknown words faster when creating dictionaries")}
     , {"partially-expand",  KeyInfoBool, "false",
        N_("partially expand affixes for better suggestions")}
     , {"skip-invalid-words",  KeyInfoBool, "true",
        N_("skip invalid words")}
+    , {"trigram-index", KeyInfoBool, "false",
+       N_("add an index for faster bad-spellers suggestions when creating dictionaries")}
     , {"validate-affixes", KeyInfoBool, "true",
        N_("check if affix flags are valid")}
     , {"validate-words", KeyInfoBool, "true",
@@ -1563,6 +1587,8 @@ namespace aspell {
        N_("use byte offsets instead of character offsets")}
     , {"guess", KeyInfoBool, "false",
        N_("create missing root/affix combinations"), KEYINFO_MAY_CHANGE}
+    , {"jobs", KeyInfoInt, "1",
+       N_("threads to use to check words, 0 for all cpus")}
     , {"keymapping", KeyInfoString, "aspell",
        N_("keymapping for check mode: \"aspell\" or \"ispell\"")}
     , {"reverse", KeyInfoBool, "false",
@@ -22,6 +22,7 @@
 #include "file_data_util.hpp"
 #include "objstack.hpp"
 #include "convert_filter.hpp"
+#include "utf8_simd.hpp"
 
 #include "indiv_filter.hpp"
 
@@ -809,20 +810,50 @@ namespace aspell {
     }
   }
   
+  // Runs of ASCII characters are only handed to the vectorized code
+  // if they are likely to be at least this long, as the call does not
+  // pay for itself on a few characters between multi-byte ones.
+  static const int min_ascii_run = 16;
+
+  // Converts the run of ASCII characters at in, if any.  The run ends
+  // at the first non-ASCII or null byte.
+  static inline void decode_ascii(const Utf8Simd * simd, const char * & in,
+                                  const char * stop, FilterCharVector & out)
+  {
+    size_t n = simd->ascii_len(in, stop);
+    if (n == 0) return;
+    simd->widen(in, n, out.data(out.alloc(n)));
+    in += n;
+  }
+
   struct DecodeUtf8 : public Decode 
   {
     ToUniLookup lookup;
     void decode(const char * in, int size, FilterCharVector & out) const {
+      const Utf8Simd * simd = utf8_simd();
+      if (simd && size < 0) size = strlen(in);
       const char * stop = in + size; // this is OK even if size == -1
       while (in != stop && *in) {
+        if (simd && stop - in >= min_ascii_run 
+            && !(in[0] & 0x80) && !(in[min_ascii_run - 1] & 0x80)) {
+          decode_ascii(simd, in, stop, out);
+          continue;
+        }
         out.append(from_utf8(in, stop));
       }
     }
     PosibErr<void> decode_ec(const char * in, int size, 
                              FilterCharVector & out, ParmStr orig) const {
+      const Utf8Simd * simd = utf8_simd();
+      if (simd && size < 0) size = strlen(in);
       const char * begin = in;
       const char * stop = in + size; // this is OK even if size == -1
       while (in != stop && *in) {
+        if (simd && stop - in >= min_ascii_run 
+            && !(in[0] & 0x80) && !(in[min_ascii_run - 1] & 0x80)) {
+          decode_ascii(simd, in, stop, out);
+          continue;
+        }
         FilterChar c = from_utf8(in, stop, (Uni32)-1);
         if (c == (Uni32)-1) {
           char m[70];
@@ -835,20 +866,35 @@ namespace aspell {
     }
   };
 
+  // Converts the run of characters below 0x80 at in, if any.
+  static inline void encode_ascii(const Utf8Simd * simd, const FilterChar * & in,
+                                  const FilterChar * stop, CharVector & out)
+  {
+    size_t pos = out.alloc(stop - in);
+    size_t n = simd->narrow(in, stop, out.data(pos));
+    out.resize(pos + n);
+    in += n;
+  }
+
   struct EncodeUtf8 : public Encode 
   {
     FromUniLookup lookup;
     void encode(const FilterChar * in, const FilterChar * stop, 
                 CharVector & out) const {
-      for (; in != stop; ++in) {
+      const Utf8Simd * simd = utf8_simd();
+      while (in != stop) {
+        if (simd && stop - in >= min_ascii_run 
+            && in[0].chr < 0x80 && in[min_ascii_run - 1].chr < 0x80) {
+          encode_ascii(simd, in, stop, out);
+          continue;
+        }
         to_utf8(*in, out);
+        ++in;
       }
     }
     PosibErr<void> encode_ec(const FilterChar * in, const FilterChar * stop, 
                              CharVector & out, ParmStr) const {
-      for (; in != stop; ++in) {
-        to_utf8(*in, out);
-      }
+      encode(in, stop, out);
       return no_err;
     }
     void encode(const FilterChar * in, const FilterChar * stop, 
@@ -15,6 +15,7 @@
 #include "stack_ptr.hpp"
 #include "filter.hpp"
 #include "cache.hpp"
+#include "atomic.hpp"
 
 namespace aspell {
 
@@ -229,9 +230,14 @@ namespace aspell {
     // this class in any way.
     Filter filter_;
 
+    // if set the number of bytes written by convert is added to it
+    volatile unsigned long * byte_count_;
+
     void add_filter_codes();
 
   public:
+
+    FullConvert() : byte_count_(0) {}
     
     PosibErr<void> add_filters(Config * c, 
                                bool use_encoder, 
@@ -254,13 +260,19 @@ namespace aspell {
     // and I have no intention to make it thus.
 
     void convert(const char * in, int size, CharVector & out) {
+      size_t prev_size = out.size();
       if (filter_.empty()) {
         simple_convert(in,size,out,buf_);
       } else {
         generic_convert(in,size,out);
       }
+      if (byte_count_) atomic_add(*byte_count_, out.size() - prev_size);
     }
 
+    // counts the bytes written by convert in c, or stops counting if
+    // c is null
+    void count_bytes(volatile unsigned long * c) {byte_count_ = c;}
+
     void generic_convert(const char * in, int size, CharVector & out);
 
     void filter(FilterChar * & start, FilterChar * & stop)
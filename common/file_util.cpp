@@ -88,6 +88,23 @@ namespace aspell {
     return s.st_mtime;
   }
 
+  long get_file_size(FStream & f) {
+    struct stat s;
+    fstat(f.file_no(), &s);
+    return s.st_size;
+  }
+
+  PosibErr<void> sync_file(FStream & f, ParmString name) {
+    f.flush();
+#if defined(WIN32) || defined(_WIN32)
+    if (_commit(f.file_no()) != 0)
+#else
+    if (fsync(f.file_no()) != 0)
+#endif
+      return make_err(cant_write_file, name);
+    return no_err;
+  }
+
   PosibErr<void> open_file_readlock(FStream & in, ParmString file) {
     RET_ON_ERR(in.open(file, "r"));
 #ifdef USE_FILE_LOCKS
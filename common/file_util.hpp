@@ -28,6 +28,9 @@ namespace aspell {
   //void open_file(FStream & in, const string & file,
   //               ParmString mode = "r");
   time_t get_modification_time(FStream & f);
+  long get_file_size(FStream & f);
+  // flushes the stream and waits for the data to reach the disk
+  PosibErr<void> sync_file(FStream & f, ParmString name);
   PosibErr<void> open_file_readlock(FStream& in, ParmString file);
   PosibErr<bool> open_file_writelock(FStream & in, ParmString file);
   // returns true if the file already exists
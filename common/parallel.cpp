@@ -0,0 +1,84 @@
+// This file is part of The New Aspell
+// Copyright (C) 2011 by Kevin Atkinson under the GNU LGPL license
+// version 2.0 or 2.1.  You should have received a copy of the LGPL
+// license along with this library if you did not you can find
+// it at http://www.gnu.org/.
+
+#include "settings.h"
+
+#include "lock.hpp"
+#include "parallel.hpp"
+#include "vector.hpp"
+
+#ifdef USE_POSIX_MUTEX
+#  include <pthread.h>
+#  include <unistd.h>
+#endif
+
+namespace aspell {
+
+  unsigned num_processors()
+  {
+#if defined(USE_POSIX_MUTEX) && defined(_SC_NPROCESSORS_ONLN)
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    if (n > 0) return n;
+#endif
+    return 1;
+  }
+
+#ifdef USE_POSIX_MUTEX
+
+  struct JobQueue {
+    Mutex lock;
+    ParallelJob * const * cur;
+    ParallelJob * const * end;
+    ParallelJob * next() {
+      LOCK(&lock);
+      if (cur == end) return 0;
+      return *cur++;
+    }
+    void run_all() {
+      ParallelJob * job;
+      while ((job = next()))
+        job->run();
+    }
+  };
+
+  static void * run_jobs(void * q)
+  {
+    static_cast<JobQueue *>(q)->run_all();
+    return 0;
+  }
+
+  void run_parallel(ParallelJob * const * jobs, unsigned num_jobs,
+                    unsigned max_threads)
+  {
+    if (max_threads == 0) max_threads = num_processors();
+    if (max_threads > num_jobs) max_threads = num_jobs;
+    JobQueue queue;
+    queue.cur = jobs;
+    queue.end = jobs + num_jobs;
+    Vector<pthread_t> threads;
+    threads.reserve(max_threads);
+    for (unsigned i = 1; i < max_threads; ++i) {
+      pthread_t t;
+      // if a thread can't be created just make do with fewer threads
+      if (pthread_create(&t, 0, run_jobs, &queue) != 0) break;
+      threads.push_back(t);
+    }
+    queue.run_all();
+    for (Vector<pthread_t>::iterator i = threads.begin(); i != threads.end(); ++i)
+      pthread_join(*i, 0);
+  }
+
+#else
+
+  void run_parallel(ParallelJob * const * jobs, unsigned num_jobs, unsigned)
+  {
+    for (unsigned i = 0; i != num_jobs; ++i)
+      jobs[i]->run();
+  }
+
+#endif
+
+}
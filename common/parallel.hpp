@@ -0,0 +1,35 @@
+// This file is part of The New Aspell
+// Copyright (C) 2011 by Kevin Atkinson under the GNU LGPL license
+// version 2.0 or 2.1.  You should have received a copy of the LGPL
+// license along with this library if you did not you can find
+// it at http://www.gnu.org/.
+
+#ifndef ASPELL_PARALLEL__HPP
+#define ASPELL_PARALLEL__HPP
+
+namespace aspell {
+
+  // A unit of work for run_parallel.  Jobs should not share any
+  // mutable state unless they provide their own locking.
+  class ParallelJob {
+  public:
+    virtual void run() = 0;
+    virtual ~ParallelJob() {}
+  };
+
+  // Runs all the jobs using at most max_threads threads, one of which
+  // is the calling thread, and returns once every job has finished.
+  // Jobs are started in order but may finish in any order.  If
+  // max_threads is 0 than one thread per processor is used.  If
+  // threads are not supported the jobs are simply run one after
+  // another.
+  void run_parallel(ParallelJob * const * jobs, unsigned num_jobs,
+                    unsigned max_threads);
+
+  // Returns the number of online processors, or 1 if that can not be
+  // determined.
+  unsigned num_processors();
+
+}
+
+#endif
@@ -51,5 +51,9 @@ namespace aspell {
   Speller::Speller(SpellerLtHandle h) : lt_handle_(h) {}
 
   Speller::~Speller() {}
+
+  SpellerContext::SpellerContext() {}
+
+  SpellerContext::~SpellerContext() {}
 }
 
@@ -23,6 +23,8 @@
 #include "parm_string.hpp"
 #include "char_vector.hpp"
 #include "check_info.hpp"
+#include "speller_stats.hpp"
+#include "vector.hpp"
 
 namespace aspell {
 
@@ -34,6 +36,7 @@ namespace aspell {
   class Filter;
   class DocumentChecker;
   class Checker;
+  class SpellerContext;
 
   struct IntrCheckInfo {
     mutable CheckInfo ext; // Stuff that is used by the C interface
@@ -80,6 +83,8 @@ namespace aspell {
     String temp_str_1;
     ClonePtr<FullConvert> to_internal_;
     ClonePtr<FullConvert> from_internal_;
+    Vector<String> batch_words_; // used by the C interface
+    Vector<const WordList *> batch_lists_;
   protected:
     CopyPtr<Config> config_;
     Speller(SpellerLtHandle h);
@@ -138,10 +143,40 @@ namespace aspell {
     // return null on error
     // the word list returned by suggest is only valid until the next
     // call to suggest
+
+    virtual PosibErr<void> suggest_batch(const MutableString * words, 
+                                         unsigned num,
+                                         const WordList * * lists) = 0;
+    // finds the suggestions for num words at once; repeated words are
+    // only looked up once and the distinct ones are spread over
+    // sug-batch-threads threads.  lists must have room for num
+    // entries.  The lists are only valid until the next call to
+    // suggest_batch.
+
+    virtual unsigned int suggest_cache_hits() const = 0;
+    virtual unsigned int suggest_cache_misses() const = 0;
+    // the number of times suggest or suggest_batch found, or did not
+    // find, the suggestions for a word in the suggestion cache
+
+    virtual unsigned int affix_cache_hits() const = 0;
+    virtual unsigned int affix_cache_misses() const = 0;
+    // the number of times a word that is not in any word list as is
+    // was found, or not found, in the cache of affix stripping results
+
+    virtual const SpellerStats * stats() = 0;
+    virtual void reset_stats() = 0;
+    // the counters collected while the "collect-stats" option is
+    // set, including those from any contexts.  The struct returned
+    // is only valid until the next call to stats.
   
     virtual PosibErr<void> store_replacement(MutableString, 
 					     MutableString) = 0;
 
+    virtual PosibErr<SpellerContext *> new_context() = 0;
+    // creates a context which can be used to check words and find
+    // suggestions from another thread, see SpellerContext.  It is
+    // safe to call this from several threads at once.
+
     virtual ~Speller();
 
     // Reload the conversion filters.  Bit of a hack, I hope to find a
@@ -158,6 +193,43 @@ namespace aspell {
 
   PosibErr<Speller *> new_speller(Config * c);
 
+  // A SpellerContext holds everything that changes when a word is
+  // checked or suggestions are found for it, so that a single Speller
+  // can be shared between threads by giving each thread its own
+  // context.  The word lists, language data and suggestion cache are
+  // shared.  While any context is in use the speller itself may not
+  // be used to change the word lists or config, and the speller must
+  // outlive all of its contexts.  The config in effect when the
+  // context is created is the one used.
+
+  class SpellerContext : public CanHaveError
+  {
+  private:
+    SpellerContext(const SpellerContext &);
+    SpellerContext & operator= (const SpellerContext &);
+  public:
+    String temp_str_0; // used by the C interface
+    String temp_str_1;
+    ClonePtr<FullConvert> to_internal_;
+    ClonePtr<FullConvert> from_internal_;
+  protected:
+    SpellerContext();
+  public:
+    virtual PosibErr<bool> check(MutableString) = 0;
+    virtual const IntrCheckInfo * intr_check_info() = 0;
+
+    virtual PosibErr<const WordList *> suggest(MutableString) = 0;
+    // the word list returned by suggest is only valid until the next
+    // call to suggest on this context
+
+    virtual ~SpellerContext();
+  };
+
+  static inline PosibErr<SpellerContext *> new_speller_context(Speller * s)
+  {
+    return s->new_context();
+  }
+
 }
 
 #endif
@@ -0,0 +1,212 @@
+// This file is part of The New Aspell
+// Copyright (C) 2011 by Kevin Atkinson under the GNU LGPL license
+// version 2.0 or 2.1.  You should have received a copy of the LGPL
+// license along with this library if you did not you can find
+// it at http://www.gnu.org/.
+
+#include "settings.h"
+
+#include "utf8_simd.hpp"
+
+#ifdef HAVE_X86_SIMD
+#  include <immintrin.h>
+#endif
+
+namespace aspell {
+
+#ifdef HAVE_X86_SIMD
+
+  // The code below stores FilterChars as pairs of 32 bit ints
+  typedef char FilterCharIsTwoInts[sizeof(FilterChar) == 8 ? 1 : -1];
+
+  static inline bool is_ascii(char c)
+  {
+    return (unsigned char)(c - 1) < 0x7F;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  //
+  // SSE2
+  //
+
+  __attribute__((target("sse2")))
+  static size_t ascii_len_sse2(const char * in, const char * stop)
+  {
+    const char * p = in;
+    const __m128i zero = _mm_setzero_si128();
+    for (; stop - p >= 16; p += 16) {
+      __m128i v = _mm_loadu_si128((const __m128i *)p);
+      // the high bit is set for non-ASCII and null bytes
+      int m = _mm_movemask_epi8(_mm_or_si128(v, _mm_cmpeq_epi8(v, zero)));
+      if (m) return p - in + __builtin_ctz(m);
+    }
+    for (; p != stop && is_ascii(*p); ++p);
+    return p - in;
+  }
+
+  __attribute__((target("sse2")))
+  static void widen_sse2(const char * in, size_t n, FilterChar * out)
+  {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one  = _mm_set1_epi32(1);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+      __m128i v  = _mm_loadu_si128((const __m128i *)(in + i));
+      __m128i lo = _mm_unpacklo_epi8(v, zero);
+      __m128i hi = _mm_unpackhi_epi8(v, zero);
+      __m128i c[4] = {_mm_unpacklo_epi16(lo, zero), _mm_unpackhi_epi16(lo, zero),
+                      _mm_unpacklo_epi16(hi, zero), _mm_unpackhi_epi16(hi, zero)};
+      __m128i * o = (__m128i *)(out + i);
+      for (int j = 0; j != 4; ++j) {
+        _mm_storeu_si128(o + 2*j,     _mm_unpacklo_epi32(c[j], one));
+        _mm_storeu_si128(o + 2*j + 1, _mm_unpackhi_epi32(c[j], one));
+      }
+    }
+    for (; i != n; ++i) out[i] = FilterChar((unsigned char)in[i], 1);
+  }
+
+  // returns the chr fields of the 4 FilterChars at in
+  __attribute__((target("sse2")))
+  static inline __m128i load_chrs_sse2(const FilterChar * in)
+  {
+    const __m128i * p = (const __m128i *)in;
+    __m128i a = _mm_shuffle_epi32(_mm_loadu_si128(p),     _MM_SHUFFLE(3,1,2,0));
+    __m128i b = _mm_shuffle_epi32(_mm_loadu_si128(p + 1), _MM_SHUFFLE(3,1,2,0));
+    return _mm_unpacklo_epi64(a, b);
+  }
+
+  __attribute__((target("sse2")))
+  static size_t narrow_sse2(const FilterChar * in, const FilterChar * stop,
+                            char * out)
+  {
+    size_t n = stop - in;
+    const __m128i high = _mm_set1_epi32(~0x7F);
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+      __m128i a = load_chrs_sse2(in + i);
+      __m128i b = load_chrs_sse2(in + i + 4);
+      __m128i t = _mm_and_si128(_mm_or_si128(a, b), high);
+      if (_mm_movemask_epi8(_mm_cmpeq_epi32(t, zero)) != 0xFFFF) break;
+      __m128i w = _mm_packs_epi32(a, b);
+      _mm_storel_epi64((__m128i *)(out + i), _mm_packus_epi16(w, w));
+    }
+    for (; i != n && in[i].chr < 0x80; ++i) out[i] = in[i].chr;
+    return i;
+  }
+
+  static const Utf8Simd utf8_sse2 = {"sse2", ascii_len_sse2, widen_sse2, narrow_sse2};
+
+  //////////////////////////////////////////////////////////////////////
+  //
+  // AVX2
+  //
+
+  __attribute__((target("avx2")))
+  static size_t ascii_len_avx2(const char * in, const char * stop)
+  {
+    const char * p = in;
+    const __m256i zero = _mm256_setzero_si256();
+    for (; stop - p >= 32; p += 32) {
+      __m256i v = _mm256_loadu_si256((const __m256i *)p);
+      unsigned m = _mm256_movemask_epi8(_mm256_or_si256(v, _mm256_cmpeq_epi8(v, zero)));
+      if (m) return p - in + __builtin_ctz(m);
+    }
+    for (; p != stop && is_ascii(*p); ++p);
+    return p - in;
+  }
+
+  __attribute__((target("avx2")))
+  static void widen_avx2(const char * in, size_t n, FilterChar * out)
+  {
+    const __m256i one = _mm256_set1_epi32(1);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+      __m256i c  = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(in + i)));
+      // lo = c0 1 c1 1 | c4 1 c5 1,  hi = c2 1 c3 1 | c6 1 c7 1
+      __m256i lo = _mm256_unpacklo_epi32(c, one);
+      __m256i hi = _mm256_unpackhi_epi32(c, one);
+      __m256i * o = (__m256i *)(out + i);
+      _mm256_storeu_si256(o,     _mm256_permute2x128_si256(lo, hi, 0x20));
+      _mm256_storeu_si256(o + 1, _mm256_permute2x128_si256(lo, hi, 0x31));
+    }
+    for (; i != n; ++i) out[i] = FilterChar((unsigned char)in[i], 1);
+  }
+
+  __attribute__((target("avx2")))
+  static size_t narrow_avx2(const FilterChar * in, const FilterChar * stop,
+                            char * out)
+  {
+    size_t n = stop - in;
+    const __m256i high = _mm256_set1_epi32(~0x7F);
+    const __m256i even = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+      const __m256i * p = (const __m256i *)(in + i);
+      __m256i a = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(p),     even);
+      __m256i b = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(p + 1), even);
+      // the chr fields are now in the low half of a and b
+      __m256i c = _mm256_permute2x128_si256(a, b, 0x20);
+      if (!_mm256_testz_si256(c, high)) break;
+      __m128i w = _mm_packs_epi32(_mm256_castsi256_si128(c),
+                                  _mm256_extracti128_si256(c, 1));
+      _mm_storel_epi64((__m128i *)(out + i), _mm_packus_epi16(w, w));
+    }
+    for (; i != n && in[i].chr < 0x80; ++i) out[i] = in[i].chr;
+    return i;
+  }
+
+  static const Utf8Simd utf8_avx2 = {"avx2", ascii_len_avx2, widen_avx2, narrow_avx2};
+
+  static const Utf8Simd * best_utf8_simd()
+  {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return &utf8_avx2;
+    if (__builtin_cpu_supports("sse2")) return &utf8_sse2;
+    return 0;
+  }
+
+  static const Utf8Simd * cur_utf8_simd = best_utf8_simd();
+
+  const Utf8Simd * utf8_simd()
+  {
+    return cur_utf8_simd;
+  }
+
+  bool set_utf8_simd(Utf8SimdLevel l)
+  {
+    const Utf8Simd * best = best_utf8_simd();
+    switch (l) {
+    case Utf8SimdNone:
+      cur_utf8_simd = 0;
+      return true;
+    case Utf8SimdSse2:
+      if (!best) return false;
+      cur_utf8_simd = &utf8_sse2;
+      return true;
+    case Utf8SimdAvx2:
+      if (best != &utf8_avx2) return false;
+      cur_utf8_simd = &utf8_avx2;
+      return true;
+    case Utf8SimdBest:
+      cur_utf8_simd = best;
+      return true;
+    }
+    return false;
+  }
+
+#else
+
+  const Utf8Simd * utf8_simd()
+  {
+    return 0;
+  }
+
+  bool set_utf8_simd(Utf8SimdLevel l)
+  {
+    return l == Utf8SimdNone || l == Utf8SimdBest;
+  }
+
+#endif
+
+}
@@ -0,0 +1,46 @@
+// This file is part of The New Aspell
+// Copyright (C) 2011 by Kevin Atkinson under the GNU LGPL license
+// version 2.0 or 2.1.  You should have received a copy of the LGPL
+// license along with this library if you did not you can find
+// it at http://www.gnu.org/.
+
+#ifndef ASPELL_UTF8_SIMD__HPP
+#define ASPELL_UTF8_SIMD__HPP
+
+#include <stddef.h>
+
+#include "filter_char.hpp"
+
+// Vectorized conversion of the ASCII runs in UTF-8 text, used by
+// DecodeUtf8 and EncodeUtf8.  Multi-byte sequences are always left to
+// the scalar code so that the validation and error positions stay
+// exactly the same.
+
+namespace aspell {
+
+  struct Utf8Simd {
+    const char * name;
+    // returns the number of bytes at the start of [in, stop) which
+    // are ASCII and not null
+    size_t (*ascii_len)(const char * in, const char * stop);
+    // converts n ASCII bytes into FilterChars of width 1
+    void (*widen)(const char * in, size_t n, FilterChar * out);
+    // converts the FilterChars at the start of [in, stop) which are
+    // below 0x80 into bytes, returns the number converted
+    size_t (*narrow)(const FilterChar * in, const FilterChar * stop,
+                     char * out);
+  };
+
+  // returns null when there is no vectorized version for this cpu
+  const Utf8Simd * utf8_simd();
+
+  enum Utf8SimdLevel {Utf8SimdNone, Utf8SimdSse2, Utf8SimdAvx2, Utf8SimdBest};
+
+  // Overrides the version picked at startup, returns false if the
+  // cpu does not support it.  Only meant for benchmarking, it is not
+  // thread safe.
+  bool set_utf8_simd(Utf8SimdLevel);
+
+}
+
+#endif
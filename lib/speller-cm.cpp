@@ -5,17 +5,18 @@
  * at http://www.gnu.org/.                                              */
 
 #include "convert.hpp"
+#include "error.hpp"
 #include "speller.hpp"
+#include "word_list.hpp"
 
 namespace aspell {
 
-extern "C" const CheckInfo * aspell_speller_check_info(Speller * ths)
+static const CheckInfo * fill_check_info(const IntrCheckInfo * ci,
+                                         String & buf, FullConvert * conv)
 {
-  const IntrCheckInfo * ci = ths->intr_check_info();
   if (ci == 0) return 0;
   //aspeller::CasePattern casep 
   //  = real_speller->lang().case_pattern(cword);
-  String & buf = ths->temp_str_1;
   const IntrCheckInfo * p = ci;
   while (p) {
     buf.clear();
@@ -41,7 +42,7 @@ extern "C" const CheckInfo * aspell_speller_check_info(Speller * ths)
     } else {
       buf.append('*');
     }
-    ths->from_internal_->convert(buf.str(), buf.size(), p->str);
+    conv->convert(buf.str(), buf.size(), p->str);
     p->ext.next = p->next ? &p->next->ext : 0;
     p->ext.str = p->str.str();
     p->ext.str_len = p->str.size();
@@ -51,6 +52,56 @@ extern "C" const CheckInfo * aspell_speller_check_info(Speller * ths)
   return &ci->ext;
 }
 
+extern "C" const CheckInfo * aspell_speller_check_info(Speller * ths)
+{
+  return fill_check_info(ths->intr_check_info(), ths->temp_str_1, 
+                         ths->from_internal_);
+}
+
+extern "C" const CheckInfo * aspell_speller_context_check_info(SpellerContext * ths)
+{
+  return fill_check_info(ths->intr_check_info(), ths->temp_str_1, 
+                         ths->from_internal_);
+}
+
+extern "C" int aspell_speller_add_to_batch(Speller * ths, 
+                                          const char * word, int word_size)
+{
+  ths->batch_words_.push_back(String());
+  ths->to_internal_->convert(word, word_size, ths->batch_words_.back());
+  return 1;
+}
+
+extern "C" int aspell_speller_suggest_batch(Speller * ths)
+{
+  unsigned num = ths->batch_words_.size();
+  Vector<MutableString> words;
+  for (unsigned i = 0; i != num; ++i) {
+    String & w = ths->batch_words_[i];
+    words.push_back(MutableString(w.mstr(), w.size()));
+  }
+  ths->batch_lists_.resize(num);
+  PosibErr<void> ret = ths->suggest_batch(words.pbegin(), num, 
+                                          ths->batch_lists_.pbegin());
+  ths->batch_words_.clear();
+  ths->err_.reset(ret.release_err());
+  if (ths->err_ != 0) {
+    ths->batch_lists_.clear();
+    return -1;
+  }
+  for (unsigned i = 0; i != num; ++i)
+    const_cast<WordList *>(ths->batch_lists_[i])->from_internal_ 
+      = ths->from_internal_;
+  return num;
+}
+
+extern "C" const WordList * aspell_speller_batch_suggestion(Speller * ths, 
+                                                            unsigned int num)
+{
+  if (num >= ths->batch_lists_.size()) return 0;
+  return ths->batch_lists_[num];
+}
+
 
 }
 
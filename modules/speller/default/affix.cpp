@@ -96,8 +96,6 @@ struct AffEntry
 struct PfxEntry : public AffEntry
 {
   PfxEntry * next;
-  PfxEntry * next_eq;
-  PfxEntry * next_ne;
   PfxEntry * flag_next;
   PfxEntry() {}
 
@@ -118,8 +116,6 @@ struct SfxEntry : public AffEntry
   const char * rappnd; // this is set in AffixMgr::build_sfxlist
   
   SfxEntry *   next;
-  SfxEntry *   next_eq;
-  SfxEntry *   next_ne;
   SfxEntry *   flag_next;
 
   SfxEntry() {}
@@ -133,7 +129,7 @@ struct SfxEntry : public AffEntry
   inline const char *  key() const  { return rappnd; } 
   void add_outer_sfx_info(IntrCheckInfo *) const;
   bool applicable(SimpleString) const;
-  SimpleString add(SimpleString, ObjStack & buf, int limit, SimpleString) const;
+  SimpleString add(SimpleString, ObjStack & buf, int limit) const;
 };
 
 //////////////////////////////////////////////////////////////////////
@@ -141,33 +137,240 @@ struct SfxEntry : public AffEntry
 // Utility functions declarations
 //
 
-/* return 1 if s1 is subset of s2 */
-static bool isSubset(const char * s1, const char * s2)
+template <class T>
+struct AffixLess
+{
+  bool operator() (T * x, T * y) const {return strcmp(x->key(),y->key()) < 0;}
+};
+
+// The compiled conditions of a run of up to COND_GROUP_SIZE affix
+// entries.  Rather than testing the conditions of each entry in
+// turn, each character they look at is looked up once for the whole
+// run, giving the set of entries whose conditions all hold.  The
+// characters are the ones left once the affix is removed, read
+// from the end of the word for suffixes and from the start for
+// prefixes.  Characters that no condition tells apart share a class
+// (see AffixMgr::cond_class) to keep the tables small.
+
+typedef unsigned long CondsMask;
+static const unsigned COND_GROUP_SIZE = sizeof(CondsMask) * 8;
+
+template <class T>
+struct CondsGroup
 {
-  while( *s1 && (*s1 == *s2) ) {
-    s1++;
-    s2++;
+  T * * entries;
+  unsigned num;
+  unsigned depth;          // the number of characters looked at
+  unsigned need_len;       // the size of need
+  CondsMask alive;         // entries that can match at all
+  const CondsMask * masks; 
+  // masks[i * num_classes + c] has bit e set if the e'th entry allows
+  // a character of class c i characters in, or does not look that far
+  const CondsMask * need;
+  // need[k] has bit e set if the e'th entry needs more than k characters
+  const CondsGroup * next;
+
+  // p points to the first character to look at, step is 1 or -1 and
+  // avail is the number of characters available
+  CondsMask match(const byte * p, int step, unsigned avail,
+                  const byte * cls, unsigned num_classes) const
+  {
+    CondsMask m = alive;
+    if (avail < need_len) m &= ~need[avail];
+    const CondsMask * mask = masks;
+    for (unsigned i = 0; m && i != depth && i != avail; ++i, p += step) {
+      m &= mask[cls[*p]];
+      mask += num_classes;
+    }
+    return m;
   }
-  return (*s1 == '\0');
+};
+
+// What the conditions of an entry are tested against.  When checking
+// a word the conditions are tested against the root, but the strip
+// string at its end (or start) is known ahead of time so only the
+// rest of the root is looked at.  When adding an affix to a root the
+// whole root is looked at.
+enum CondsUse {CondsCheck, CondsAdd};
+
+// the number of characters the conditions of e look at
+template <class T>
+static inline unsigned cond_depth(const T * e, CondsUse use)
+{
+  int skip = use == CondsCheck ? e->stripl : 0;
+  int num = e->conds->num;
+  return num > skip ? num - skip : 0;
+}
+
+// the number of characters e needs to be there
+template <class T>
+static inline unsigned cond_need(const T * e, CondsUse use)
+{
+  if (use == CondsCheck) return cond_depth(e, use);
+  unsigned num = e->conds->num;
+  return num > e->stripl ? num : e->stripl + 1;
+}
+
+// the bit in Conds::conds for the i'th character looked at, or -1 if
+// the entry does not look that far
+template <class T>
+static inline int cond_bit(const T * e, bool suffix, CondsUse use, unsigned i)
+{
+  if (i >= cond_depth(e, use)) return -1;
+  int skip = use == CondsCheck ? e->stripl : 0;
+  return suffix ? e->conds->num - 1 - skip - i : skip + i;
 }
 
-// return 1 if s1 (reversed) is a leading subset of end of s2
-static bool isRevSubset(const char * s1, const char * end_of_s2, int len)
+template <class T>
+static inline bool cond_holds(const T * e, int bit, byte c)
 {
-  while( (len > 0) && *s1 && (*s1 == *end_of_s2) ) {
-    s1++;
-    end_of_s2--;
-    len --;
+  return (e->conds->get(c) & (1 << bit)) != 0;
+}
+
+template <class T>
+static unsigned list_size(T * p, T * T::*link = &T::next)
+{
+  unsigned num = 0;
+  for (; p; p = p->*link) ++num;
+  return num;
+}
+
+// compiles the conditions of the num entries starting at first,
+// linked by link, into a chain of CondsGroups
+
+template <class T>
+static const CondsGroup<T> * compile_conds(T * first, T * T::*link, unsigned num,
+                                           bool suffix, CondsUse use,
+                                           const byte * cls, unsigned num_classes,
+                                           ObjStack & buf)
+{
+  byte rep[SETSIZE]; // a character in each class
+  for (int c = SETSIZE - 1; c >= 0; --c) rep[cls[c]] = c;
+
+  const CondsGroup<T> * head = 0;
+  const CondsGroup<T> * * prev = &head;
+  while (num > 0) {
+    CondsGroup<T> * g 
+      = (CondsGroup<T> *)buf.alloc_top(sizeof(CondsGroup<T>), sizeof(void *));
+    g->num = num < COND_GROUP_SIZE ? num : COND_GROUP_SIZE;
+    g->entries = (T * *)buf.alloc_top(sizeof(T *) * g->num, sizeof(void *));
+    g->depth = 0;
+    g->need_len = 0;
+    g->alive = 0;
+    for (unsigned e = 0; e != g->num; ++e, first = first->*link) {
+      g->entries[e] = first;
+      if (g->depth < cond_depth(first, use)) g->depth = cond_depth(first, use);
+      if (g->need_len < cond_need(first, use)) g->need_len = cond_need(first, use);
+      // when checking, the strip string becomes part of the root so
+      // the conditions on it can be tested now
+      bool alive = true;
+      if (use == CondsCheck) {
+        int num_conds = first->conds->num;
+        for (int i = 0; i != first->stripl; ++i) {
+          int bit = suffix ? num_conds - first->stripl + i : i;
+          if (bit < 0 || bit >= num_conds) continue;
+          if (!cond_holds(first, bit, first->strip[i])) alive = false;
+        }
+      }
+      if (alive) g->alive |= (CondsMask)1 << e;
+    }
+    CondsMask * masks 
+      = (CondsMask *)buf.alloc_top(sizeof(CondsMask) * g->depth * num_classes, 
+                                   sizeof(CondsMask));
+    for (unsigned i = 0; i != g->depth; ++i) {
+      for (unsigned c = 0; c != num_classes; ++c) {
+        CondsMask m = 0;
+        for (unsigned e = 0; e != g->num; ++e) {
+          int bit = cond_bit(g->entries[e], suffix, use, i);
+          if (bit < 0 || cond_holds(g->entries[e], bit, rep[c]))
+            m |= (CondsMask)1 << e;
+        }
+        masks[i * num_classes + c] = m;
+      }
+    }
+    g->masks = masks;
+    CondsMask * need 
+      = (CondsMask *)buf.alloc_top(sizeof(CondsMask) * g->need_len, 
+                                   sizeof(CondsMask));
+    for (unsigned k = 0; k != g->need_len; ++k) {
+      CondsMask m = 0;
+      for (unsigned e = 0; e != g->num; ++e)
+        if (cond_need(g->entries[e], use) > k) m |= (CondsMask)1 << e;
+      need[k] = m;
+    }
+    g->need = need;
+    g->next = 0;
+    *prev = g;
+    prev = &g->next;
+    num -= g->num;
   }
-  return (*s1 == '\0');
+  return head;
 }
 
+// A node in the trie of prefix strings, or of reversed suffix
+// strings.  The entries whose key ends at this node are in group,
+// in the order of the sorted list.  The children are sorted by chr.
+
 template <class T>
-struct AffixLess
+struct AffixNode
 {
-  bool operator() (T * x, T * y) const {return strcmp(x->key(),y->key()) < 0;}
+  const CondsGroup<T> * group;
+  unsigned num_kids;
+  const byte * chrs;
+  AffixNode * kids;
+  const AffixNode * find(byte c) const {
+    for (unsigned i = 0; i != num_kids && chrs[i] <= c; ++i)
+      if (chrs[i] == c) return kids + i;
+    return 0;
+  }
 };
 
+// builds the trie below node from the num entries starting at
+// first, which must be sorted and all share the first depth
+// characters of their keys
+
+template <class T>
+static void build_trie(AffixNode<T> * node, T * first, unsigned num, 
+                       unsigned depth, bool suffix, 
+                       const byte * cls, unsigned num_classes, ObjStack & buf)
+{
+  T * entries = first;
+  unsigned num_entries = 0;
+  while (num > 0 && first->key()[depth] == '\0') {
+    ++num_entries;
+    first = first->next;
+    --num;
+  }
+  node->group = compile_conds(entries, &T::next, num_entries, suffix, CondsCheck,
+                              cls, num_classes, buf);
+  node->num_kids = 0;
+  node->chrs = 0;
+  node->kids = 0;
+  if (num == 0) return;
+
+  // count the distinct characters, the entries are sorted so equal
+  // ones are next to each other
+  T * p = first;
+  T * prev = 0;
+  for (unsigned i = 0; i != num; ++i, prev = p, p = p->next)
+    if (!prev || p->key()[depth] != prev->key()[depth]) ++node->num_kids;
+  byte * chrs = (byte *)buf.alloc_top(node->num_kids);
+  node->kids = (AffixNode<T> *)buf.alloc_top(sizeof(AffixNode<T>) * node->num_kids,
+                                             sizeof(void *));
+  node->chrs = chrs;
+
+  AffixNode<T> * kid = node->kids;
+  while (num > 0) {
+    byte c = first->key()[depth];
+    unsigned n = 0;
+    for (p = first; n != num && (byte)p->key()[depth] == c; p = p->next) ++n;
+    *chrs++ = c;
+    build_trie(kid++, first, n, depth + 1, suffix, cls, num_classes, buf);
+    first = p;
+    num -= n;
+  }
+}
+
 // struct StringLookup {
 //   struct Parms {
 //     typedef const char * Value;
@@ -239,6 +442,9 @@ static int normalize_cond_str(char * str)
 static void encodeit(CondsLookup &, ObjStack &, 
                      AffEntry * ptr, char * cs);
 
+static void split_cond_classes(const CondsLookup &, 
+                               byte * cond_class, unsigned & num_cond_classes);
+
 //////////////////////////////////////////////////////////////////////
 //
 // Affix Manager
@@ -252,10 +458,18 @@ PosibErr<void> AffixMgr::setup(ParmString affpath, Conv & iconv)
   for (int i=0; i < SETSIZE; i++) {
     pStart[i] = NULL;
     sStart[i] = NULL;
+    pTrie[i] = NULL;
+    sTrie[i] = NULL;
+    pFlagConds[i] = NULL;
+    sFlagConds[i] = NULL;
     pFlag[i] = NULL;
     sFlag[i] = NULL;
     max_strip_f[i] = 0;
   }
+  pZero = NULL;
+  sZero = NULL;
+  memset(cond_class, 0, sizeof(cond_class));
+  num_cond_classes = 1;
   return parse_file(affpath, iconv);
 }
 
@@ -458,33 +672,28 @@ PosibErr<void> AffixMgr::parse_file(const char * affpath, Conv & iconv)
   }
   afflst.close();
 
-  // now we can speed up performance greatly taking advantage of the 
-  // relationship between the affixes and the idea of "subsets".
+  // the conditions are compiled into tables indexed by character
+  // class, so first work out which characters need to be told apart
 
-  // View each prefix as a potential leading subset of another and view
-  // each suffix (reversed) as a potential trailing subset of another.
+  split_cond_classes(conds_lookup, cond_class, num_cond_classes);
 
-  // To illustrate this relationship if we know the prefix "ab" is
-  // found in the word to examine, only prefixes that "ab" is a
-  // leading subset of need be examined.  Furthermore is "ab" is not
-  // present then none of the prefixes that "ab" is is a subset need
-  // be examined.
+  // now we can speed up performance greatly by building a trie of
+  // the prefix strings and one of the reversed suffix strings.
 
-  // The same argument goes for suffix string that are reversed.
+  // When checking a word only the entries whose string actually
+  // matches the start (or end) of the word then need be examined:
+  // we follow the characters of the word down the trie, visiting
+  // the entries at each node on the way, and stop as soon as there
+  // is no child for the next character.
 
-  // Then to top this off why not examine the first char of the word
-  // to quickly limit the set of prefixes to examine (i.e. the
-  // prefixes to examine must be leading supersets of the first
-  // character of the word (if they exist)
- 
-  // To take advantage of this "subset" relationship, we need to add
-  // two links from entry.  One to take next if the current prefix
-  // is found (call it nexteq) and one to take next if the current
-  // prefix is not found (call it nextne).
+  // The entries are visited shortest string first and, for entries
+  // with the same string, in the order of the sorted lists, so the
+  // first entry to match is the same one that walking the lists
+  // would find.
 
-  // Since we have built ordered lists, all that remains is to
-  // properly intialize the nextne and nexteq pointers that relate
-  // them
+  // The conditions of the entries at each node are compiled so that
+  // the ones that apply are found with a single pass over the
+  // characters they look at (see CondsGroup).
 
   process_pfx_order();
   process_sfx_order();
@@ -561,107 +770,94 @@ PosibErr<void> AffixMgr::build_sfxlist(SfxEntry* sfxptr)
 
 
 
-// initialize the PfxEntry links NextEQ and NextNE to speed searching
+// puts characters that no condition tells apart in the same class
+static void split_cond_classes(const CondsLookup & conds_lookup, 
+                               byte * cond_class, unsigned & num_cond_classes)
+{
+  // start with every character in one class and split the classes
+  // by the bits each Conds gives the characters
+  memset(cond_class, 0, SETSIZE);
+  num_cond_classes = 1;
+  Vector<unsigned> seen(SETSIZE * SETSIZE, 0);
+  Vector<byte> split(SETSIZE * SETSIZE);
+  unsigned gen = 0;
+  for (CondsLookup::const_iterator i = conds_lookup.begin(); 
+       i != conds_lookup.end(); 
+       ++i)
+  {
+    ++gen;
+    unsigned num = 0;
+    for (int c = 0; c != SETSIZE; ++c) {
+      unsigned key = cond_class[c] * SETSIZE + (byte)(*i)->conds[c];
+      if (seen[key] != gen) {seen[key] = gen; split[key] = num++;}
+      cond_class[c] = split[key];
+    }
+    num_cond_classes = num;
+  }
+}
+
+// sort each prefix list and build the trie of prefix strings
 PosibErr<void> AffixMgr::process_pfx_order()
 {
   PfxEntry* ptr;
 
+  pZero = compile_conds(pStart[0], &PfxEntry::next, list_size(pStart[0]),
+                        false, CondsCheck, cond_class, num_cond_classes, data_buf);
+  for (int i = 0; i < SETSIZE; i++)
+    pFlagConds[i] = compile_conds(pFlag[i], &PfxEntry::flag_next, 
+                                  list_size(pFlag[i], &PfxEntry::flag_next),
+                                  false, CondsAdd, 
+                                  cond_class, num_cond_classes, data_buf);
+
   // loop through each prefix list starting point
   for (int i=1; i < SETSIZE; i++) {
 
+    pTrie[i] = NULL;
+
     ptr = pStart[i];
+    if (ptr == NULL) continue;
 
-    if (ptr && ptr->next)
+    if (ptr->next)
       ptr = pStart[i] = sort(ptr, AffixLess<PfxEntry>());
 
-    // look through the remainder of the list
-    //  and find next entry with affix that 
-    // the current one is not a subset of
-    // mark that as destination for NextNE
-    // use next in list that you are a subset
-    // of as NextEQ
-
-    for (; ptr != NULL; ptr = ptr->next) {
-
-      PfxEntry * nptr = ptr->next;
-      for (; nptr != NULL; nptr = nptr->next) {
-        if (! isSubset( ptr->key() , nptr->key() )) break;
-      }
-      ptr->next_ne = nptr;
-      ptr->next_eq = NULL;
-      if ((ptr->next) && isSubset(ptr->key() , 
-                                  (ptr->next)->key())) 
-        ptr->next_eq = ptr->next;
-    }
-
-    // now clean up by adding smart search termination strings
-    // if you are already a superset of the previous prefix
-    // but not a subset of the next, search can end here
-    // so set NextNE properly
-
-    ptr = pStart[i];
-    for (; ptr != NULL; ptr = ptr->next) {
-      PfxEntry * nptr = ptr->next;
-      PfxEntry * mptr = NULL;
-      for (; nptr != NULL; nptr = nptr->next) {
-        if (! isSubset(ptr->key(),nptr->key())) break;
-        mptr = nptr;
-      }
-      if (mptr) mptr->next_ne = NULL;
-    }
+    PfxNode * node = (PfxNode *)data_buf.alloc_top(sizeof(PfxNode), sizeof(void *));
+    build_trie(node, pStart[i], list_size(pStart[i]), 1, false,
+               cond_class, num_cond_classes, data_buf);
+    pTrie[i] = node;
   }
   return no_err;
 }
 
 
 
-// initialize the SfxEntry links NextEQ and NextNE to speed searching
+// sort each suffix list and build the trie of reversed suffix strings
 PosibErr<void> AffixMgr::process_sfx_order()
 {
   SfxEntry* ptr;
 
-  // loop through each prefix list starting point
+  sZero = compile_conds(sStart[0], &SfxEntry::next, list_size(sStart[0]),
+                        true, CondsCheck, cond_class, num_cond_classes, data_buf);
+  for (int i = 0; i < SETSIZE; i++)
+    sFlagConds[i] = compile_conds(sFlag[i], &SfxEntry::flag_next, 
+                                  list_size(sFlag[i], &SfxEntry::flag_next),
+                                  true, CondsAdd, 
+                                  cond_class, num_cond_classes, data_buf);
+
+  // loop through each suffix list starting point
   for (int i=1; i < SETSIZE; i++) {
 
+    sTrie[i] = NULL;
+
     ptr = sStart[i];
+    if (ptr == NULL) continue;
 
-    if (ptr && ptr->next)
+    if (ptr->next)
       ptr = sStart[i] = sort(ptr, AffixLess<SfxEntry>());
 
-    // look through the remainder of the list
-    //  and find next entry with affix that 
-    // the current one is not a subset of
-    // mark that as destination for NextNE
-    // use next in list that you are a subset
-    // of as NextEQ
-
-    for (; ptr != NULL; ptr = ptr->next) {
-      SfxEntry * nptr = ptr->next;
-      for (; nptr != NULL; nptr = nptr->next) {
-        if (! isSubset(ptr->key(),nptr->key())) break;
-      }
-      ptr->next_ne = nptr;
-      ptr->next_eq = NULL;
-      if ((ptr->next) && isSubset(ptr->key(),(ptr->next)->key())) 
-        ptr->next_eq = ptr->next;
-    }
-
-
-    // now clean up by adding smart search termination strings:
-    // if you are already a superset of the previous suffix
-    // but not a subset of the next, search can end here
-    // so set NextNE properly
-
-    ptr = sStart[i];
-    for (; ptr != NULL; ptr = ptr->next) {
-      SfxEntry * nptr = ptr->next;
-      SfxEntry * mptr = NULL;
-      for (; nptr != NULL; nptr = nptr->next) {
-        if (! isSubset(ptr->key(),nptr->key())) break;
-        mptr = nptr;
-      }
-      if (mptr) mptr->next_ne = NULL;
-    }
+    SfxNode * node = (SfxNode *)data_buf.alloc_top(sizeof(SfxNode), sizeof(void *));
+    build_trie(node, sStart[i], list_size(sStart[i]), 1, true,
+               cond_class, num_cond_classes, data_buf);
+    sTrie[i] = node;
   }
   return no_err;
 }
@@ -791,24 +987,33 @@ bool AffixMgr::prefix_check (const LookupInfo & linf, ParmString word,
                              IntrCheckInfo & ci, GuessInfo * gi, bool cross) const
 {
  
+  const byte * w   = reinterpret_cast<const byte *>(word.str());
+  const byte * end = w + word.size();
+
   // first handle the special case of 0 length prefixes
-  PfxEntry * pe = pStart[0];
-  while (pe) {
-    if (pe->check(linf,this,word,ci,gi)) return true;
-    pe = pe->next;
+  for (const PfxGroup * g = pZero; g; g = g->next) {
+    CondsMask m = g->match(w, 1, word.size(), cond_class, num_cond_classes);
+    for (unsigned e = 0; m; ++e, m >>= 1) {
+      if ((m & 1) && g->entries[e]->check(linf,this,word,ci,gi)) return true;
+    }
   }
   
-  // now handle the general case
-  byte sp = *reinterpret_cast<const byte *>(word.str());
-  PfxEntry * pptr = pStart[sp];
-
-  while (pptr) {
-    if (isSubset(pptr->key(),word)) {
-      if (pptr->check(linf,this,word,ci,gi,cross)) return true;
-      pptr = pptr->next_eq;
-    } else {
-      pptr = pptr->next_ne;
+  // now handle the general case by following the word down the
+  // trie, visiting only the prefixes that match its start and whose
+  // conditions hold for the rest of it
+  if (w == end) return false;
+  const PfxNode * node = pTrie[*w];
+
+  while (node) {
+    ++w;
+    for (const PfxGroup * g = node->group; g; g = g->next) {
+      CondsMask m = g->match(w, 1, end - w, cond_class, num_cond_classes);
+      for (unsigned e = 0; m; ++e, m >>= 1) {
+        if ((m & 1) && g->entries[e]->check(linf,this,word,ci,gi,cross)) return true;
+      }
     }
+    if (w == end) break;
+    node = node->find(*w);
   }
     
   return false;
@@ -821,24 +1026,34 @@ bool AffixMgr::suffix_check (const LookupInfo & linf, ParmString word,
                              const PfxEntry * ppfx, const SfxEntry * psfx) const
 {
 
+  const byte * begin = reinterpret_cast<const byte *>(word.str());
+  const byte * w     = begin + word.size();
+
   // first handle the special case of 0 length suffixes
-  SfxEntry * se = sStart[0];
-  while (se) {
-    if (se->check(linf, this, word, ci, gi, ppfx, psfx)) return true;
-    se = se->next;
+  for (const SfxGroup * g = sZero; g; g = g->next) {
+    CondsMask m = g->match(w - 1, -1, word.size(), cond_class, num_cond_classes);
+    for (unsigned e = 0; m; ++e, m >>= 1) {
+      if ((m & 1) && g->entries[e]->check(linf, this, word, ci, gi, ppfx, psfx)) 
+        return true;
+    }
   }
   
-  // now handle the general case
-  byte sp = *((const byte *)(word + word.size() - 1));
-  SfxEntry * sptr = sStart[sp];
-
-  while (sptr) {
-    if (isRevSubset(sptr->key(), word + word.size() - 1, word.size())) {
-      if (sptr->check(linf, this, word, ci, gi, ppfx, psfx)) return true;
-      sptr = sptr->next_eq;
-    } else {
-      sptr = sptr->next_ne;
+  // now handle the general case by following the word backwards
+  // down the trie, visiting only the suffixes that match its end and
+  // whose conditions hold for the rest of it
+  if (w == begin) return false;
+  const SfxNode * node = sTrie[*--w];
+
+  while (node) {
+    for (const SfxGroup * g = node->group; g; g = g->next) {
+      CondsMask m = g->match(w - 1, -1, w - begin, cond_class, num_cond_classes);
+      for (unsigned e = 0; m; ++e, m >>= 1) {
+        if ((m & 1) && g->entries[e]->check(linf, this, word, ci, gi, ppfx, psfx)) 
+          return true;
+      }
     }
+    if (w == begin) break;
+    node = node->find(*--w);
   }
     
   return false;
@@ -919,13 +1134,18 @@ WordAff * AffixMgr::expand(ParmString word, ParmString aff,
     if (sFlag[*c]) *suf_e++ = *c; 
     if (sFlag[*c] && sFlag[*c]->allow_cross()) *csuf_e++ = *c;
     
-    for (PfxEntry * p = pFlag[*c]; p; p = p->flag_next) {
-      SimpleString newword = p->add(word, buf);
-      if (!newword) continue;
-      cur->next = (WordAff *)buf.alloc_bottom(sizeof(WordAff));
-      cur = cur->next;
-      cur->word = newword;
-      cur->aff = p->allow_cross() ? csuf : empty;
+    for (const PfxGroup * g = pFlagConds[*c]; g; g = g->next) {
+      CondsMask m = g->match((const byte *)word.str(), 1, word.size(), 
+                             cond_class, num_cond_classes);
+      for (unsigned e = 0; m; ++e, m >>= 1) {
+        if (!(m & 1)) continue;
+        PfxEntry * p = g->entries[e];
+        SimpleString newword = p->add(word, buf);
+        cur->next = (WordAff *)buf.alloc_bottom(sizeof(WordAff));
+        cur = cur->next;
+        cur->word = newword;
+        cur->aff = p->allow_cross() ? csuf : empty;
+      }
     }
   }
   *suf_e = 0;
@@ -961,20 +1181,26 @@ WordAff * AffixMgr::expand_suffix(ParmString word, const byte * aff,
 
   while (*aff) {
     if ((int)word.size() - max_strip_f[*aff] < limit) {
-      for (SfxEntry * p = sFlag[*aff]; p; p = p->flag_next) {
-        SimpleString newword = p->add(word, buf, limit, orig_word);
-        if (!newword) continue;
-        if (newword == EMPTY) {not_expanded = true; continue;}
-        *cur = (WordAff *)buf.alloc_bottom(sizeof(WordAff));
-        (*cur)->word = newword;
-        (*cur)->aff  = (const byte *)EMPTY;
-        cur = &(*cur)->next;
-        expanded = true;
-        // Now handle the two-fold suffix case
-        // FIXME: I am making some, possible invalid, assumtions
-        //        when limit is used
-        if (twofold && p->flags[0]) {
-          expand_suffix(newword, (const byte *)p->flags, buf, INT_MAX, 0, &cur, orig_word, false);
+      const byte * end = (const byte *)orig_word.str() + orig_word.size();
+      for (const SfxGroup * g = sFlagConds[*aff]; g; g = g->next) {
+        CondsMask m = g->match(end - 1, -1, orig_word.size(), 
+                               cond_class, num_cond_classes);
+        for (unsigned e = 0; m; ++e, m >>= 1) {
+          if (!(m & 1)) continue;
+          SfxEntry * p = g->entries[e];
+          SimpleString newword = p->add(word, buf, limit);
+          if (newword == EMPTY) {not_expanded = true; continue;}
+          *cur = (WordAff *)buf.alloc_bottom(sizeof(WordAff));
+          (*cur)->word = newword;
+          (*cur)->aff  = (const byte *)EMPTY;
+          cur = &(*cur)->next;
+          expanded = true;
+          // Now handle the two-fold suffix case
+          // FIXME: I am making some, possible invalid, assumtions
+          //        when limit is used
+          if (twofold && p->flags[0]) {
+            expand_suffix(newword, (const byte *)p->flags, buf, INT_MAX, 0, &cur, orig_word, false);
+          }
         }
       }
     } 
@@ -1017,8 +1243,10 @@ int LookupInfo::lookup (ParmString word, const SensitiveCompare * c,
 {
   SpellerImpl::WS::const_iterator i = begin;
   const char * g = 0;
+  if (stats) ++stats->affix_candidates;
   if (mode == Word) {
     do {
+      if (stats) ++stats->probes;
       (*i)->lookup(word, c, o);
       for (;!o.at_end(); o.adv()) {
         if (TESTAFF(o.aff, achar))
@@ -1030,6 +1258,7 @@ int LookupInfo::lookup (ParmString word, const SensitiveCompare * c,
     } while (i != end);
   } else if (mode == Clean) {
     do {
+      if (stats) ++stats->probes;
       (*i)->clean_lookup(word, o);
       for (;!o.at_end(); o.adv()) {
         if (TESTAFF(o.aff, achar))
@@ -1070,27 +1299,15 @@ bool PfxEntry::applicable(SimpleString word) const
   return false;
 }
 
-// add prefix to this word assuming conditions hold
+// add prefix to this word assuming conditions hold, which
+// AffixMgr::expand has already tested
 SimpleString PfxEntry::add(SimpleString word, ObjStack & buf) const
 {
-  unsigned int cond;
-  /* make sure all conditions match */
-  if ((word.size > stripl) && (word.size >= conds->num)) {
-    const byte * cp = (const byte *) word.str;
-    for (cond = 0;  cond < conds->num;  cond++) {
-      if ((conds->get(*cp++) & (1 << cond)) == 0)
-        break;
-    }
-    if (cond >= conds->num) {
-      /* */
-      int alen = word.size - stripl;
-      char * newword = (char *)buf.alloc(alen + appndl + 1);
-      if (appndl) memcpy(newword, appnd, appndl);
-      memcpy(newword + appndl, word + stripl, alen + 1);
-      return SimpleString(newword, alen + appndl);
-    }
-  }
-  return SimpleString();
+  int alen = word.size - stripl;
+  char * newword = (char *)buf.alloc(alen + appndl + 1);
+  if (appndl) memcpy(newword, appnd, appndl);
+  memcpy(newword + appndl, word + stripl, alen + 1);
+  return SimpleString(newword, alen + appndl);
 }
 
 // check if this prefix entry matches 
@@ -1098,20 +1315,19 @@ bool PfxEntry::check(const LookupInfo & linf, const AffixMgr * pmyMgr,
                      ParmString word,
                      IntrCheckInfo & ci, GuessInfo * gi, bool cross) const
 {
-  unsigned int		cond;	// condition number being examined
   unsigned              tmpl;   // length of tmpword
   WordEntry             wordinfo;     // hash entry of root word or NULL
-  byte *	cp;		
   VARARRAYM(char, tmpword, word.size()+stripl+1, MAXWORDLEN+1);
 
-  // on entry prefix is 0 length or already matches the beginning of the word.
-  // So if the remaining root word has positive length
-  // and if there are enough chars in root word and added back strip chars
-  // to meet the number of characters conditions, then test it
+  // on entry prefix is 0 length or already matches the beginning of the word
+  // and AffixMgr::prefix_check has made sure all of the conditions on
+  // characters are met (please see the appendix at the end of this
+  // file for more info on exactly what is being tested).  So if the
+  // remaining root word has positive length then test it
 
   tmpl = word.size() - appndl;
 
-  if ((tmpl > 0) &&  (tmpl + stripl >= conds->num)) {
+  if (tmpl > 0) {
 
     // generate new root word by removing prefix and adding
     // back any characters that would have been stripped
@@ -1119,20 +1335,9 @@ bool PfxEntry::check(const LookupInfo & linf, const AffixMgr * pmyMgr,
     if (stripl) strcpy (tmpword, strip);
     strcpy ((tmpword + stripl), (word + appndl));
 
-    // now make sure all of the conditions on characters
-    // are met.  Please see the appendix at the end of
-    // this file for more info on exactly what is being
-    // tested
-
-    cp = (byte *)tmpword;
-    for (cond = 0;  cond < conds->num;  cond++) {
-      if ((conds->get(*cp++) & (1 << cond)) == 0) break;
-    }
-
-    // if all conditions are met then check if resulting
-    // root word in the dictionary
+    // check if resulting root word in the dictionary
 
-    if (cond >= conds->num) {
+    {
       IntrCheckInfo * lci = 0;
       IntrCheckInfo * guess = 0;
       tmpl += stripl;
@@ -1219,29 +1424,18 @@ bool SfxEntry::applicable(SimpleString word) const
   return false;
 }
 
-// add suffix to this word assuming conditions hold
+// add suffix to this word assuming conditions hold for orig_word,
+// which AffixMgr::expand_suffix has already tested
 SimpleString SfxEntry::add(SimpleString word, ObjStack & buf, 
-                           int limit, SimpleString orig_word) const
+                           int limit) const
 {
-  int cond;
-  /* make sure all conditions match */
-  if ((orig_word.size > stripl) && (orig_word.size >= conds->num)) {
-    const byte * cp = (const byte *) (orig_word + orig_word.size);
-    for (cond = conds->num; --cond >=0; ) {
-      if ((conds->get(*--cp) & (1 << cond)) == 0)
-        break;
-    }
-    if (cond < 0) {
-      int alen = word.size - stripl;
-      if (alen >= limit) return EMPTY;
-      /* we have a match so add suffix */
-      char * newword = (char *)buf.alloc(alen + appndl + 1);
-      memcpy(newword, word, alen);
-      memcpy(newword + alen, appnd, appndl + 1);
-      return SimpleString(newword, alen + appndl);
-    }
-  }
-  return SimpleString();
+  int alen = word.size - stripl;
+  if (alen >= limit) return EMPTY;
+  /* we have a match so add suffix */
+  char * newword = (char *)buf.alloc(alen + appndl + 1);
+  memcpy(newword, word, alen);
+  memcpy(newword + alen, appnd, appndl + 1);
+  return SimpleString(newword, alen + appndl);
 }
 
 // see if this suffix is present in the word 
@@ -1251,9 +1445,8 @@ bool SfxEntry::check(const LookupInfo & linf, const AffixMgr * pmyMgr,
                      const PfxEntry * ppfx, const SfxEntry * psfx) const
 {
   unsigned              tmpl;		 // length of tmpword 
-  int			cond;		 // condition beng examined
   WordEntry             wordinfo;        // hash entry pointer
-  byte *	cp;
+  char *	cp;
   VARARRAYM(char, tmpword, word.size()+stripl+1, MAXWORDLEN+1);
 
   // check to make sure if this suffix is even valid in light of:
@@ -1274,40 +1467,30 @@ bool SfxEntry::check(const LookupInfo & linf, const AffixMgr * pmyMgr,
       (ppfx && ((ppfx->xpflgs ^ xpflgs) & CIRCUMFIX)))
     return false;
 
-  // upon entry suffix is 0 length or already matches the end of the word.
-  // So if the remaining root word has positive length
-  // and if there are enough chars in root word and added back strip chars
-  // to meet the number of characters conditions, then test it
+  // upon entry suffix is 0 length or already matches the end of the word
+  // and AffixMgr::suffix_check has made sure all of the conditions on
+  // characters are met (please see the appendix at the end of this
+  // file for more info on exactly what is being tested).  So if the
+  // remaining root word has positive length then test it
 
   tmpl = word.size() - appndl;
 
-  if ((tmpl > 0)  &&  (tmpl + stripl >= conds->num)) {
+  if (tmpl > 0) {
 
     // generate new root word by removing suffix and adding
     // back any characters that would have been stripped or
     // or null terminating the shorter string
 
     strcpy (tmpword, word);
-    cp = (byte *)(tmpword + tmpl);
+    cp = tmpword + tmpl;
     if (stripl) {
-      strcpy ((char *)cp, strip);
+      strcpy (cp, strip);
       tmpl += stripl;
-      cp = (byte *)(tmpword + tmpl);
     } else *cp = '\0';
 
-    // now make sure all of the conditions on characters
-    // are met.  Please see the appendix at the end of
-    // this file for more info on exactly what is being
-    // tested
+    // check if resulting root word in the dictionary
 
-    for (cond = conds->num;  --cond >= 0; ) {
-      if ((conds->get(*--cp) & (1 << cond)) == 0) break;
-    }
-
-    // if all conditions are met then check if resulting
-    // root word in the dictionary
-
-    if (cond < 0) {
+    {
       IntrCheckInfo * lci = 0;
       const SensitiveCompare * cmp = 
         ppfx ? &linf.sp->s_cmp_middle : &linf.sp->s_cmp_begin;
@@ -1368,6 +1551,115 @@ void SfxEntry::add_outer_sfx_info(IntrCheckInfo * c) const {
   if (inner_prefix_len < 0) c->suf_strip_len += -inner_prefix_len;
 }
 
+//////////////////////////////////////////////////////////////////////
+//
+// AffixCache
+//
+
+struct AffixCache::Entry
+{
+  String key;
+  bool used;
+  bool res;
+  // the parts of IntrCheckInfo filled in by affix_check
+  ParmString word;
+  const char * pre_add;
+  const char * inner_suf_add;
+  const char * outer_suf_add;
+  short pre_strip_len, pre_add_len;
+  short suf_strip_len, suf_add_len;
+  short pre_flag, suf_flag;
+  short inner_suf_strip_len, inner_suf_add_len;
+  short outer_suf_strip_len, outer_suf_add_len;
+  Entry() : used(false) {}
+};
+
+AffixCache::AffixCache()
+  : table_(0), max_size_(0), hits_(0), misses_(0) {}
+
+AffixCache::~AffixCache()
+{
+  delete[] table_;
+}
+
+void AffixCache::set_max_size(unsigned size)
+{
+  LOCK(&lock_);
+  if (size == max_size_) return;
+  delete[] table_;
+  table_ = size ? new Entry[size] : 0;
+  max_size_ = size;
+}
+
+AffixCache::Entry & AffixCache::slot(ParmString word) const
+{
+  unsigned long h = 0;
+  for (const char * i = word; *i; ++i)
+    h = 5*h + *i;
+  return table_[h % max_size_];
+}
+
+bool AffixCache::lookup(ParmString word, IntrCheckInfo & ci, bool & res)
+{
+  LOCK(&lock_);
+  if (max_size_ == 0) return false;
+  Entry & e = slot(word);
+  if (!e.used || e.key != word) {
+    ++misses_;
+    return false;
+  }
+  ++hits_;
+  res = e.res;
+  if (!res) return true;
+  ci.word = e.word;
+  ci.pre_add = e.pre_add;
+  ci.inner_suf_add = e.inner_suf_add;
+  ci.outer_suf_add = e.outer_suf_add;
+  ci.pre_strip_len = e.pre_strip_len;
+  ci.pre_add_len = e.pre_add_len;
+  ci.suf_strip_len = e.suf_strip_len;
+  ci.suf_add_len = e.suf_add_len;
+  ci.pre_flag = e.pre_flag;
+  ci.suf_flag = e.suf_flag;
+  ci.inner_suf_strip_len = e.inner_suf_strip_len;
+  ci.inner_suf_add_len = e.inner_suf_add_len;
+  ci.outer_suf_strip_len = e.outer_suf_strip_len;
+  ci.outer_suf_add_len = e.outer_suf_add_len;
+  return true;
+}
+
+void AffixCache::insert(ParmString word, const IntrCheckInfo & ci, bool res)
+{
+  LOCK(&lock_);
+  if (max_size_ == 0) return;
+  Entry & e = slot(word);
+  e.key = word;
+  e.used = true;
+  e.res = res;
+  if (!res) return;
+  e.word = ci.word;
+  e.pre_add = ci.pre_add;
+  e.inner_suf_add = ci.inner_suf_add;
+  e.outer_suf_add = ci.outer_suf_add;
+  e.pre_strip_len = ci.pre_strip_len;
+  e.pre_add_len = ci.pre_add_len;
+  e.suf_strip_len = ci.suf_strip_len;
+  e.suf_add_len = ci.suf_add_len;
+  e.pre_flag = ci.pre_flag;
+  e.suf_flag = ci.suf_flag;
+  e.inner_suf_strip_len = ci.inner_suf_strip_len;
+  e.inner_suf_add_len = ci.inner_suf_add_len;
+  e.outer_suf_strip_len = ci.outer_suf_strip_len;
+  e.outer_suf_add_len = ci.outer_suf_add_len;
+}
+
+void AffixCache::clear()
+{
+  LOCK(&lock_);
+  for (unsigned i = 0; i != max_size_; ++i)
+    table_[i].used = false;
+}
+
 //////////////////////////////////////////////////////////////////////
 //
 // new_affix_mgr
@@ -18,6 +18,7 @@
 #include "simple_string.hpp"
 #include "char_vector.hpp"
 #include "objstack.hpp"
+#include "lock.hpp"
 
 #define SETSIZE         256
 #define MAXAFFIXES      256
@@ -47,6 +48,12 @@ namespace sp {
   struct AffEntry;
   struct PfxEntry;
   struct SfxEntry;
+  template <class T> struct AffixNode;
+  typedef AffixNode<PfxEntry> PfxNode;
+  typedef AffixNode<SfxEntry> SfxNode;
+  template <class T> struct CondsGroup;
+  typedef CondsGroup<PfxEntry> PfxGroup;
+  typedef CondsGroup<SfxEntry> SfxGroup;
 
   enum CheckAffixRes {InvalidAffix, InapplicableAffix, ValidAffix};
 
@@ -59,6 +66,22 @@ namespace sp {
     PfxEntry *          pFlag[SETSIZE];
     SfxEntry *          sFlag[SETSIZE];
 
+    // tries of the prefix strings and reversed suffix strings,
+    // indexed by the first character, built by process_*_order
+    const PfxNode *     pTrie[SETSIZE];
+    const SfxNode *     sTrie[SETSIZE];
+
+    // the compiled conditions of the 0 length affixes, which are not
+    // in the tries, and of the entries for each flag, used by expand
+    const PfxGroup *    pZero;
+    const SfxGroup *    sZero;
+    const PfxGroup *    pFlagConds[SETSIZE];
+    const SfxGroup *    sFlagConds[SETSIZE];
+
+    // characters that none of the conditions tell apart share a class
+    unsigned char       cond_class[SETSIZE];
+    unsigned            num_cond_classes;
+
     int max_strip_f[SETSIZE];
     int max_strip_;
 
@@ -116,6 +139,38 @@ namespace sp {
     PosibErr<void> process_sfx_order();
   };
 
+  // A bounded cache of the results of AffixMgr::affix_check,
+  // including negative ones, kept by each speller.  Each word hashes
+  // to exactly one slot, so a lookup is a single probe and a new word
+  // simply replaces whatever was in its slot.  The roots returned
+  // point into the word lists, so the cache must be cleared whenever
+  // a writable word list changes.
+  class AffixCache {
+  public:
+    AffixCache();
+    ~AffixCache();
+    void set_max_size(unsigned);
+    // returns false, and leaves ci and res alone, if word is not in
+    // the cache; otherwise sets res to the result of affix_check and
+    // if it is true fills in ci as affix_check would have
+    bool lookup(ParmString word, IntrCheckInfo & ci, bool & res);
+    void insert(ParmString word, const IntrCheckInfo & ci, bool res);
+    void clear();
+    unsigned max_size() const {return max_size_;}
+    unsigned hits() const {return hits_;}
+    unsigned misses() const {return misses_;}
+  private:
+    struct Entry;
+    Entry * table_;
+    unsigned max_size_;
+    unsigned hits_;
+    unsigned misses_;
+    Mutex lock_;
+    Entry & slot(ParmString word) const;
+    AffixCache(const AffixCache &);
+    void operator=(const AffixCache &);
+  };
+
   PosibErr<AffixMgr *> new_affix_mgr(ParmString name, 
                                      Conv &,
                                      const LangImpl * lang);
@@ -43,6 +43,9 @@ namespace aspell { namespace sp {
 
     aspell::String split_chars;
 
+    unsigned scan_threads; // 0 = one per processor
+    unsigned batch_threads; // likewise, used by suggest batch
+
     SuggestParms() {}
     
     aspell::PosibErr<void> set(ParmString mode, SpellerImpl * sp);
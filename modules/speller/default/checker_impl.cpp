@@ -11,6 +11,7 @@ namespace aspell { namespace sp {
     void i_reset(Segment * seg);
     void i_recheck(Segment * seg);
     const CheckerToken * next();
+    const char * cur_word() const {return word.str();}
     
     String word;
     SegmentIterator prev_;
@@ -83,6 +84,7 @@ namespace aspell { namespace sp {
     token.begin.offset = cur_.offset;
     token.b.seg = cur_.seg;
     token.b.pos = cur_.pos;
+    token.b.raw_pos = cur_.raw_pos;
 
     if (is_begin(*cur_))
     {
@@ -107,8 +109,12 @@ namespace aspell { namespace sp {
     token.end.offset = cur_.offset;
     token.e.seg = cur_.seg;
     token.e.pos = cur_.pos;
+    token.e.raw_pos = cur_.raw_pos;
 
-    token.correct = speller->check(word);
+    if (check_words_)
+      token.correct = speller->check(word);
+    else
+      token.correct = false;
 
     free_segments(0, prev_.seg);
 
@@ -286,6 +286,26 @@ namespace aspell { namespace sp {
   {
     return 0;
   }
+
+  SoundslikeEnumeration * Dictionary::soundslike_elements(unsigned, unsigned) const
+  {
+    return 0;
+  }
+
+  SoundslikeEnumeration * Dictionary::soundslike_neighbors(ParmString) const
+  {
+    return 0;
+  }
+
+  SoundslikeEnumeration * Dictionary::soundslike_trigrams(ParmString) const
+  {
+    return 0;
+  }
+
+  SoundslikeEnumeration * Dictionary::expanded_elements(unsigned, unsigned) const
+  {
+    return 0;
+  }
   
   PosibErr<void> Dictionary::add(ParmString w, ParmString s) 
   {
@@ -422,8 +442,12 @@ namespace aspell { namespace sp {
     Lock dict_cache_lock(NULL);
 
     if (actual_type == DT_ReadOnly) { // try to get it from the cache
-      dict_cache_lock.set(&dict_cache.lock); 
       res = dict_cache.find(id);
+      if (!res) {
+        dict_cache_lock.set(&dict_cache.lock); 
+        // it may have been added while waiting for the lock
+        res = dict_cache.find(id);
+      }
     }
 
     if (!res) {
@@ -449,15 +473,10 @@ namespace aspell { namespace sp {
       RET_ON_ERR(w->load(true_file_name, config, new_dicts, speller));
 
       if (actual_type == DT_ReadOnly)
-        dict_cache.add(w);
+        dict_cache.add(w, id);
       
       res = w.release();
 
-    } else { // actual_type == DT_ReadOnly implied, and hence the lock
-             // is already acquired
-
-      res->copy_no_lock();
-      
     }
 
     dict_cache_lock.release();
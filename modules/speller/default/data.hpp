@@ -143,6 +143,38 @@ namespace aspell { namespace sp {
     // times in the list....
     virtual SoundslikeEnumeration * soundslike_elements() const;
 
+    // splits the elements returned by soundslike_elements() into
+    // "num" parts which can be scanned independently.  When scanned
+    // in order the parts return exactly the same elements as
+    // soundslike_elements().  Returns 0 if the dictionary can't be
+    // split.
+    virtual SoundslikeEnumeration * soundslike_elements(unsigned part, 
+                                                        unsigned num) const;
+
+    // returns the elements whose soundslike is within one edit of sl,
+    // and possibly a few others, in the same order as
+    // soundslike_elements().  Returns 0 if the dictionary does not
+    // have an index for this, in which case soundslike_elements()
+    // needs to be scanned instead.
+    virtual SoundslikeEnumeration * soundslike_neighbors(ParmString sl) const;
+
+    // returns the elements whose soundslike has a three character
+    // string in common with sl, and possibly a few others.  Returns 0
+    // if the dictionary does not have an index for this or sl is
+    // shorter than three characters.
+    virtual SoundslikeEnumeration * soundslike_trigrams(ParmString sl) const;
+
+    // returns the elements of the expanded form index, split into
+    // parts like soundslike_elements(part, num).  The index has the
+    // soundslike of every word and of every form made by adding
+    // suffixes to it, so that the forms do not need to be made while
+    // scanning.  Each element is a soundslike (what == Soundslike) for
+    // which soundslike_lookup returns the words and forms, without any
+    // affix flags.  Returns 0 if the dictionary does not have the
+    // index.
+    virtual SoundslikeEnumeration * expanded_elements(unsigned part, 
+                                                      unsigned num) const;
+
     virtual PosibErr<void> add(ParmString w, ParmString s);
     PosibErr<void> add(ParmString w);
 
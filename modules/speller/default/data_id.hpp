@@ -24,6 +24,17 @@ namespace aspell { namespace sp {
     return *id_ == o;
   }
 
+  // must agree with operator== when one of the ids has no ptr, which
+  // is always the case when searching the cache
+  inline unsigned long cache_key_hash(const Dict::Id & id)
+  {
+#ifdef USE_FILE_INO
+    return id.ino ^ id.dev;
+#else
+    return id.file_name ? cache_key_hash(id.file_name) : 0;
+#endif
+  }
+
 } }
 
 #endif
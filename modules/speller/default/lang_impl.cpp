@@ -204,6 +204,7 @@ namespace aspell { namespace sp {
     to_clean_[0x10] = 0x10;
 
     clean_chars_   = get_clean_chars(*this);
+    clean_chars_.ensure_null_end();
 
     //
     // determine which mapping to use
@@ -271,6 +272,12 @@ namespace aspell { namespace sp {
 
     have_soundslike_ = strcmp(soundslike_->name(), "none") != 0;
 
+    // the other soundslikes are cheaper to compute than to look up
+    if (strcmp(soundslike_->name(), "phonet") == 0) {
+      int size = config->retrieve_int("soundslike-cache-size");
+      if (size > 0) soundslike_cache_.reset(new SoundslikeCache(size));
+    }
+
     //
     // prep affix code
     //
@@ -111,6 +111,7 @@ namespace sp {
     bool have_repl_;
 
     StackPtr<Soundslike> soundslike_;
+    StackPtr<SoundslikeCache> soundslike_cache_; // null if not used
     StackPtr<AffixMgr>   affix_;
     StackPtr<Config>     lang_config_;
 
@@ -251,7 +252,9 @@ namespace sp {
     }
 
 
-    const char * clean_chars() const {return clean_chars_.c_str();}
+    // null terminated by setup, c_str() is not used as it writes to
+    // the string and the suggestion code calls this from many threads
+    const char * clean_chars() const {return clean_chars_.pbegin();}
 
     //
     // Soundslike
@@ -273,6 +276,22 @@ namespace sp {
       return soundslike_->to_soundslike(res,str,len);
     }
 
+    // like to_soundslike but goes through the soundslike cache when
+    // the language has one, len must be given
+    char * to_soundslike_cached(char * res, const char * str, int len) const {
+      if (!soundslike_cache_) return soundslike_->to_soundslike(res,str,len);
+      char * e = soundslike_cache_->lookup(res, str, len);
+      if (e) return e;
+      e = soundslike_->to_soundslike(res,str,len);
+      soundslike_cache_->insert(str, len, res, e - res);
+      return e;
+    }
+
+    char * to_soundslike_cached(char * res, const char * str, int len, WordInfo wi) const {
+      if (!have_soundslike_ && (wi & ALL_CLEAN)) return 0;
+      else return to_soundslike_cached(res,str,len);
+    }
+
     char * to_soundslike(char * res, const char * str, int len, WordInfo wi) const {
       if (!have_soundslike_ && (wi & ALL_CLEAN)) return 0;
       else return soundslike_->to_soundslike(res,str,len);
@@ -38,6 +38,7 @@
 #include "lang_impl.hpp"
 #include "objstack.hpp"
 #include "vararray.hpp"
+#include "vector.hpp"
 
 namespace aspell { namespace sp {
 
@@ -63,13 +64,39 @@ namespace aspell { namespace sp {
   }
 #endif
 
+  // A rule split into its parts so that phonet does not need to look
+  // for the special characters each time it is tried.  A rule is:
+  //   <first><letters>[(<letters>)][-...][<][<priority>][^[^]|$|^$]
+  struct PhonetParms::Rule {
+    char first;          // null for the rule after the last one
+    char tail0;          // the character after the letters and "(..)"
+    char end;            // what is left after the '-'s, '<', priority
+                         //   and a leading "^" of "^^", the rule
+                         //   only fits if it is null, '^' or '$'
+    char follow_end;     // likewise without skipping the "^" of "^^",
+                         //   as seen when checking follow-up rules
+    bool end_dollar;     // end is '^' and is followed by '$'
+    bool any_lt;         // the rule has a '<' somewhere after first
+    bool any_caret2;     // the rule has "^^" somewhere after first
+    int num_letters;
+    int dashes;
+    int priority;        // 5 if not given
+    const char * letters;  // the letters after first
+    const char * paren;    // just after the '(' to the end of the
+                           //   rule or null if there is no "(..)"
+    const char * replace;
+  };
+
   struct PhonetParmsImpl : public PhonetParms {
     void * data;
     ObjStack strings;
+    Vector<Rule> compiled_rules;
     PhonetParmsImpl() : data(0) {}
     ~PhonetParmsImpl() {if (data) free(data);}
   };
 
+  static void compile_phonet_rule(const char * rule, const char * replace,
+                                  PhonetParms::Rule & r);
   static void init_phonet_hash(PhonetParms & parms);
 
   // like strcpy but safe if the strings overlap
@@ -151,11 +178,57 @@ namespace aspell { namespace sp {
                             : 0);
     }
 
+    parms->compiled_rules.resize(num + 1);
+    for (int i = 0; i <= num; ++i)
+      compile_phonet_rule(parms->rules[2*i], parms->rules[2*i+1], 
+                          parms->compiled_rules[i]);
+    parms->compiled = parms->compiled_rules.data();
+
     init_phonet_hash(*parms);
 
     return parms;
   }
 
+  static void compile_phonet_rule(const char * rule, const char * replace,
+                                  PhonetParms::Rule & r)
+  {
+    memset(&r, 0, sizeof(r));
+    r.first = rule[0];
+    r.replace = replace;
+    if (r.first == '\0') return;
+    const char * s = rule + 1;
+    r.letters = s;
+    while (*s != '\0' && !asc_isdigit(*s) && strchr("(-<^$", *s) == NULL)
+      s++;
+    r.num_letters = s - r.letters;
+    if (*s == '(') {
+      r.paren = s + 1;
+      while (*s != ')' && *s != '\0')
+        s++;
+      if (*s == ')')
+        s++;
+    }
+    r.tail0 = *s;
+    while (*s == '-') {
+      r.dashes++;
+      s++;
+    }
+    if (*s == '<')
+      s++;
+    r.priority = 5;
+    if (asc_isdigit(*s)) {
+      r.priority = *s - '0';
+      s++;
+    }
+    r.follow_end = *s;
+    if (*s == '^' && *(s+1) == '^')
+      s++;
+    r.end = *s;
+    r.end_dollar = *s == '^' && *(s+1) == '$';
+    r.any_lt = strchr(rule + 1, '<') != NULL;
+    r.any_caret2 = strstr(rule + 1, "^^") != NULL;
+  }
+
   static void init_phonet_hash(PhonetParms & parms) 
   {
     int i, k;
@@ -164,9 +237,9 @@ namespace aspell { namespace sp {
       parms.hash[i] = -1;
     }
 
-    for (i = 0; parms.rules[i] != PhonetParms::rules_end; i += 2) {
+    for (i = 0; parms.compiled[i].first != '\0'; i++) {
       /**  set hash value  **/
-      k = (unsigned char) parms.rules[i][0];
+      k = (unsigned char) parms.compiled[i].first;
 
       if (parms.hash[k] < 0) {
 	parms.hash[k] = i;
@@ -181,8 +254,8 @@ namespace aspell { namespace sp {
   {
     /**  dump tracing info  **/
     
-    printf ("%s %d:  \"%s\"  >  \"%s\" %s", text, ((n/2)+1), parms.rules[n],
-	    parms.rules[n+1], error);
+    printf ("%s %d:  \"%s\"  >  \"%s\" %s", text, n+1, parms.rules[2*n],
+	    parms.rules[2*n+1], error);
   }
 #endif
 
@@ -196,12 +269,13 @@ namespace aspell { namespace sp {
     /**  result:  >= 0:  length of "target"    **/
     /**            otherwise:  error            **/
 
-    int  i,j,k=0,n,p,z;
+    int  i,j,k=0,m,n,p,z;
     int  k0,n0,p0=-333,z0;
     if (len == -1) len = strlen(inword);
     VARARRAY(char, word, len + 1);
     char c, c0;
     const char * s;
+    const PhonetParms::Rule * rules = parms.compiled;
 
     typedef unsigned char uchar;
     
@@ -226,54 +300,52 @@ namespace aspell { namespace sp {
 
       if (n >= 0) {
         /**  check all rules for the same letter  **/
-        while (parms.rules[n][0] == c) {
+        while (rules[n].first == c) {
+          const PhonetParms::Rule & r = rules[n];
           #ifdef PHONET_TRACE
              trace_info ("\n> Checking rule No.",n,"",parms);
           #endif
 
           /**  check whole string  **/
           k = 1;   /** number of found letters  **/
-          p = 5;   /** default priority  **/
-          s = parms.rules[n];
-          s++;     /**  important for (see below)  "*(s-1)"  **/
-          
-          while (*s != '\0'  &&  word[i+k] == *s
-                 &&  !asc_isdigit (*s)  &&  strchr ("(-<^$", *s) == NULL) {
+          m = 0;
+          while (m != r.num_letters  &&  word[i+k] == r.letters[m]) {
             k++;
-            s++;
+            m++;
+          }
+          if (m != r.num_letters) {
+            p0 = (int) r.letters[m];
+            n++;
+            continue;
           }
-          if (*s == '(') {
+          if (r.paren) {
             /**  check letters in "(..)"  **/
             if (parms.lang->is_alpha(word[i+k])  // ...could be implied?
-                && strchr(s+1, word[i+k]) != NULL) {
+                && strchr(r.paren, word[i+k]) != NULL) {
               k++;
-              while (*s != ')')
-                s++;
-              s++;
+            } else {
+              p0 = (int) '(';
+              n++;
+              continue;
             }
           }
-          p0 = (int) *s;
+          p0 = (int) r.tail0;
           k0 = k;
-          while (*s == '-'  &&  k > 1) {
-            k--;
-            s++;
-          }
-          if (*s == '<')
-            s++;
-          if (asc_isdigit (*s)) {
-            /**  determine priority  **/
-            p = *s - '0';
-            s++;
+          if (r.dashes >= k) {
+            /**  not enough letters for the '-'s  **/
+            k = 1;
+            n++;
+            continue;
           }
-          if (*s == '^'  &&  *(s+1) == '^')
-            s++;
+          k -= r.dashes;
+          p = r.priority;
 
-          if (*s == '\0'
-              || (*s == '^'  
+          if (r.end == '\0'
+              || (r.end == '^'  
                   && (i == 0  ||  ! parms.lang->is_alpha(word[i-1]))
-                  && (*(s+1) != '$'
+                  && (! r.end_dollar
                       || (! parms.lang->is_alpha(word[i+k0]) )))
-              || (*s == '$'  &&  i > 0  
+              || (r.end == '$'  &&  i > 0  
                   &&  parms.lang->is_alpha(word[i-1])
                   && (! parms.lang->is_alpha(word[i+k0]) ))) 
           {
@@ -285,7 +357,8 @@ namespace aspell { namespace sp {
             if (parms.followup  &&  k > 1  &&  n0 >= 0
                 &&  p0 != (int) '-'  &&  word[i+k] != '\0') {
               /**  test follow-up rule for "word[i+k]"  **/
-              while (parms.rules[n0][0] == c0) {
+              while (rules[n0].first == c0) {
+                const PhonetParms::Rule & f = rules[n0];
                 #ifdef PHONET_TRACE
                     trace_info ("\n> > follow-up rule No.",n0,"... ",parms);
                 #endif
@@ -293,46 +366,45 @@ namespace aspell { namespace sp {
                 /**  check whole string  **/
                 k0 = k;
                 p0 = 5;
-                s = parms.rules[n0];
-                s++;
-                while (*s != '\0'  &&  word[i+k0] == *s
-                       && ! asc_isdigit(*s)  &&  strchr("(-<^$",*s) == NULL) {
+                m = 0;
+                while (m != f.num_letters  &&  word[i+k0] == f.letters[m]) {
                   k0++;
-                  s++;
+                  m++;
                 }
-                if (*s == '(') {
+                if (m != f.num_letters) {
+                  #ifdef PHONET_TRACE
+                      cout << "discarded";
+                  #endif
+                  n0++;
+                  continue;
+                }
+                if (f.paren) {
                   /**  check letters  **/
                   if (parms.lang->is_alpha(word[i+k0])
-                      &&  strchr (s+1, word[i+k0]) != NULL) {
+                      &&  strchr (f.paren, word[i+k0]) != NULL) {
                     k0++;
-                    while (*s != ')'  &&  *s != '\0')
-                      s++;
-                    if (*s == ')')
-                      s++;
+                  } else {
+                    #ifdef PHONET_TRACE
+                        cout << "discarded";
+                    #endif
+                    n0++;
+                    continue;
                   }
                 }
-                while (*s == '-') {
-                  /**  "k0" gets NOT reduced   **/
-                  /**  because "if (k0 == k)"  **/
-                  s++;
-                }
-                if (*s == '<')
-                  s++;
-                if (asc_isdigit (*s)) {
-                  p0 = *s - '0';
-                  s++;
-                }
+                /**  "k0" gets NOT reduced by the '-'s  **/
+                /**  because "if (k0 == k)"  **/
+                p0 = f.priority;
 
-                if (*s == '\0'
+                if (f.follow_end == '\0'
                     /**  *s == '^' cuts  **/
-                    || (*s == '$'  &&  ! parms.lang->is_alpha(word[i+k0]))) 
+                    || (f.follow_end == '$'  &&  ! parms.lang->is_alpha(word[i+k0]))) 
                 {
                   if (k0 == k) {
                     /**  this is just a piece of the string  **/
                     #ifdef PHONET_TRACE
                         cout << "discarded (too short)";
                     #endif
-                    n0 += 2;
+                    n0++;
                     continue;
                   }
 
@@ -341,7 +413,7 @@ namespace aspell { namespace sp {
                     #ifdef PHONET_TRACE
                         cout << "discarded (priority)";
                     #endif
-                    n0 += 2;
+                    n0++;
                     continue;
                   }
                   /**  rule fits; stop search  **/
@@ -350,16 +422,16 @@ namespace aspell { namespace sp {
                 #ifdef PHONET_TRACE
                     cout << "discarded";
                 #endif
-                n0 += 2;
-              } /**  End of "while (parms.rules[n0][0] == c0)"  **/
+                n0++;
+              } /**  End of "while (rules[n0].first == c0)"  **/
 
-              if (p0 >= p  && parms.rules[n0][0] == c0) {
+              if (p0 >= p  && rules[n0].first == c0) {
                 #ifdef PHONET_TRACE
                     trace_info ("\n> Rule No.", n,"",parms);
                     trace_info ("\n> not used because of follow-up",
                                       n0,"",parms);
                 #endif
-                n += 2;
+                n++;
                 continue;
               }
             } /** end of follow-up stuff **/
@@ -368,9 +440,8 @@ namespace aspell { namespace sp {
             #ifdef PHONET_TRACE
                 trace_info ("\nUsing rule No.", n,"\n",parms);
             #endif
-            s = parms.rules[n+1];
-            p0 = (parms.rules[n][0] != '\0'
-                 &&  strchr (parms.rules[n]+1,'<') != NULL) ? 1:0;
+            s = r.replace;
+            p0 = r.any_lt ? 1:0;
             if (p0 == 1 &&  z == 0) {
               /**  rule with '<' is used  **/
               if (j > 0  &&  *s != '\0'
@@ -404,8 +475,7 @@ namespace aspell { namespace sp {
               }
               /**  new "actual letter"  **/
               c = *s;
-              if (parms.rules[n][0] != '\0'
-                 &&  strstr (parms.rules[n]+1, "^^") != NULL) {
+              if (r.any_caret2) {
                 if (c != '\0') {
                   target[j] = c;
                   j++;
@@ -417,8 +487,8 @@ namespace aspell { namespace sp {
             }
             break;
           }  /** end of follow-up stuff **/
-          n += 2;
-        } /**  end of while (parms.rules[n][0] == c)  **/
+          n++;
+        } /**  end of while (rules[n].first == c)  **/
       } /**  end of if (n >= 0)  **/
       if (z0 == 0) {
         if (k && (assert(p0!=-333),!p0) &&  j < len &&  c != '\0'
@@ -45,8 +45,13 @@ namespace aspell { namespace sp {
 
     char to_clean[256];
 
+    // the rules parsed once when loaded, in the same order as rules
+    // and followed by one whose first letter is null
+    struct Rule;
+    const Rule * compiled;
+
     static const int hash_size = 256;
-    int hash[hash_size];
+    int hash[hash_size]; // index of the first compiled rule for a letter
 
     virtual ~PhonetParms() {}
   };
@@ -1,5 +1,7 @@
 // Copyright 2000 by Kevin Atkinson under the terms of the LGPL
 
+#include <string.h>
+
 #include "file_util.hpp"
 #include "file_data_util.hpp"
 #include "clone_ptr.hpp"
@@ -181,6 +183,59 @@ namespace aspell { namespace sp {
   };
   
   
+  struct SoundslikeCache::Entry {
+    // the word followed by its soundslike, without nulls, word_len is
+    // 0 for an unused slot
+    unsigned char word_len;
+    unsigned char sl_len;
+    char data[30];
+  };
+
+  SoundslikeCache::SoundslikeCache(unsigned size)
+    : table_(new Entry[size]), size_(size)
+  {
+    memset(table_, 0, sizeof(Entry) * size);
+  }
+
+  SoundslikeCache::~SoundslikeCache()
+  {
+    delete[] table_;
+  }
+
+  static inline unsigned long sl_cache_hash(const char * word, unsigned len)
+  {
+    unsigned long h = 0;
+    for (const char * i = word, * e = word + len; i != e; ++i)
+      h = 5*h + *i;
+    return h;
+  }
+
+  char * SoundslikeCache::lookup(char * res, const char * word, unsigned len)
+  {
+    if (len == 0 || len > sizeof(Entry().data)) return 0;
+    unsigned i = sl_cache_hash(word, len) % size_;
+    LOCK(&locks_[i % num_locks]);
+    const Entry & e = table_[i];
+    if (e.word_len != len || memcmp(e.data, word, len) != 0) return 0;
+    memcpy(res, e.data + len, e.sl_len);
+    res[e.sl_len] = '\0';
+    return res + e.sl_len;
+  }
+
+  void SoundslikeCache::insert(const char * word, unsigned len, 
+                               const char * sl, unsigned sl_len)
+  {
+    if (len == 0 || len + sl_len > sizeof(Entry().data)) return;
+    unsigned i = sl_cache_hash(word, len) % size_;
+    LOCK(&locks_[i % num_locks]);
+    Entry & e = table_[i];
+    if (e.word_len != 0) return;
+    e.word_len = len;
+    e.sl_len = sl_len;
+    memcpy(e.data, word, len);
+    memcpy(e.data + len, sl, sl_len);
+  }
+  
   PosibErr<Soundslike *> new_soundslike(ParmString name, 
                                         Conv & iconv,
                                         const LangImpl * lang)
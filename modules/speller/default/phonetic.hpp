@@ -3,6 +3,7 @@
 #ifndef __aspeller_phonetic__
 #define __aspeller_phonetic__
 
+#include "lock.hpp"
 #include "string.hpp"
 
 namespace aspell { 
@@ -24,6 +25,34 @@ namespace sp {
     virtual ~Soundslike() {}
   };
 
+  // Remembers the soundslike of converted words, for soundslikes that
+  // are costly to compute.  A word is only kept if its slot is empty:
+  // the words converted are mostly those of the dictionaries, which
+  // are scanned in the same order each time, so replacing words would
+  // mean that few of them are still there when next needed.  Words
+  // too long for a slot are not kept.  It is shared by every speller
+  // using the language, so each group of slots has its own lock to
+  // keep threads scanning at the same time from waiting on each
+  // other.
+  class SoundslikeCache {
+  public:
+    SoundslikeCache(unsigned size);
+    ~SoundslikeCache();
+    // returns the end of the soundslike written to res, or null if
+    // the word is not in the cache
+    char * lookup(char * res, const char * word, unsigned len);
+    void insert(const char * word, unsigned len, 
+                const char * sl, unsigned sl_len);
+  private:
+    struct Entry;
+    Entry * table_;
+    unsigned size_;
+    static const unsigned num_locks = 64;
+    Mutex locks_[num_locks];
+    SoundslikeCache(const SoundslikeCache &);
+    void operator=(const SoundslikeCache &);
+  };
+
   PosibErr<Soundslike *> new_soundslike(ParmString name,
                                         Conv & conv,
                                         const LangImpl * lang);
@@ -11,6 +11,10 @@
 // * jump table for editdist 2
 // * data block
 // * hash table
+// * lookup filter (optional)
+// * deletion index (optional)
+// * trigram index (optional)
+// * expanded form index (optional)
 
 // data block laid out as follows:
 //
@@ -28,9 +32,71 @@
 //   bit    6: have affix info
 //   bit    7: have compound info
 
+// hash table laid out as follows:
+//   (<16 bit: tag>{10}<16 bit: overflow><16 bit: unused>
+//    <32 bit: offset in the data block of a word>{10})+
+// Each bucket is 64 bytes and starts on a multiple of 64 bytes from
+// the beginning of the file so that it fills a single cache line.  A
+// word goes in the first free slot of its home bucket, or of the
+// buckets after it (wrapping around) if that is full, in which case
+// the overflow field of each full bucket passed is set.  The home
+// bucket and the tag both come from word_hash() of the clean form of
+// the word; a tag of 0 marks an empty slot.  A lookup only compares
+// words whose tag matches and stops at the first bucket without the
+// overflow field set.  Files older than "rowl 1.11" instead have an
+// open addressing table of 32 bit offsets, see VectorHashTable.
+
+// lookup filter laid out as follows:
+//   <32 bit: number of blocks (n)><32 bit: number of bits per word (k)>
+//   <padding so that the blocks start on a multiple of 64 bytes from
+//    the beginning of the file>
+//   <512 bit block>{n}
+// The lookup filter is a Bloom filter over the clean form of every
+// word in the hash table.  All k bits for a word are in the same
+// block so that a query only touches a single cache line.  If any of
+// the bits are not set the word is not in the dictionary.
+
+// deletion index laid out as follows:
+//   <32 bit: number of buckets (n)><32 bit: unused>
+//   <32 bit: index of the first item in each bucket>{n+1}
+//   <32 bit: offset in the data block of an item>*
+// Each soundslike (or word when the soundslike is not stored) is put
+// in the bucket of its own hash and the hash of every string formed
+// by deleting a single character from it.  Within a bucket the items
+// are in the same order as they are in the data block.  Any two
+// soundslikes within one edit of each other (with a swap counting as
+// one) will share a bucket.
+
+// trigram index laid out in the same way as the deletion index.  Each
+// soundslike (or word when the soundslike is not stored) is put in
+// the bucket of the hash of every three character string in it.  Any
+// two soundslikes that have a three character string in common will
+// share a bucket.
+
+// expanded form index laid out as follows:
+//   <32 bit: number of soundslikes (n)><32 bit: number of forms (m)>
+//   <32 bit: index of the first form of each soundslike>{n+1}
+//   (<32 bit: offset of the soundslike from the start of the strings>
+//    <32 bit: index of the next soundslike not sharing the first
+//     character of this one>
+//    <32 bit: likewise for the first two characters>
+//    <32 bit: likewise for the first three characters>){n}
+//   (<32 bit: offset in the data block of a word><32 bit: form number>){m}
+//   <strings: (<8 bit: size of the prefix shared with the previous
+//              soundslike><soundslike><null>){n}>
+// The index is only stored with partially expanded dictionaries.  It
+// has the soundslike of every word, and of every form made by adding
+// suffixes to it, sorted on the soundslike.
+// The form number is the position of the form in the list returned by
+// AffixMgr::expand_suffix, starting from 1, or 0 for the word itself.
+// The links to the next soundslike play the same role as the jump
+// tables do for the data block.
+
+#include <algorithm>
 #include <utility>
 using std::pair;
 
+#include <stddef.h>
 #include <string.h>
 #include <stdio.h>
 //#include <errno.h>
@@ -51,6 +117,7 @@ using std::pair;
 #include "vector_hash-t.hpp"
 #include "check_list.hpp"
 #include "lsort.hpp"
+#include "parallel.hpp"
 
 #include "iostream.hpp"
 
@@ -180,6 +247,94 @@ static inline bool duplicate_flag(const char * d) {
   return get_flags(d) & DUPLICATE_FLAG;
 }
 
+// the hash used by the deletion index, the character at "skip" is
+// left out; this must not change without changing the file format
+static inline u32int deletion_hash(const char * b, const char * e, 
+                                   const char * skip)
+{
+  u32int h = 0;
+  for (; b != e; ++b) {
+    if (b == skip) continue;
+    h = 5*h + *reinterpret_cast<const byte *>(b);
+  }
+  return h;
+}
+
+// the hash used by the trigram index of the three characters starting
+// at p; this must not change without changing the file format
+static inline u32int trigram_hash(const char * p)
+{
+  const byte * b = reinterpret_cast<const byte *>(p);
+  return (b[0] * 65599u + b[1]) * 65599u + b[2];
+}
+
+// the hash used by the hash table and lookup filter, only the clean
+// characters of the word are used so that equal words get the same
+// hash; this must not change without changing the file format
+static inline u32int word_hash(const aspell::sp::LangImpl * lang, 
+                               const char * w)
+{
+  u32int h = 2166136261u;
+  for (; *w; ++w) {
+    unsigned char c = lang->to_clean(*w);
+    if (c) {h ^= c; h *= 16777619u;}
+  }
+  return h;
+}
+
+// used to get more bits out of a word_hash, the bucket or block is
+// chosen by the hash itself and anything within it by the mix
+static inline u32int hash_mix(u32int h)
+{
+  h ^= h >> 16; h *= 0x85ebca6bu;
+  h ^= h >> 13; h *= 0xc2b2ae35u;
+  h ^= h >> 16;
+  return h;
+}
+
+struct WordBucket {
+  static const unsigned int size = 10;
+  u16int tag[size];
+  u16int overflow;
+  u16int unused;
+  u32int offset[size];
+};
+
+// never 0 as that marks an empty slot
+static inline u16int word_tag(u32int h)
+{
+  return (u16int)(hash_mix(h) >> 16) | 1;
+}
+
+static const u32int filter_block_size = 16; // in 32 bit words
+static const u32int filter_bits_per_word = 10;
+static const u32int filter_num_probes = 6;
+
+static inline bool filter_maybe(const u32int * filter, u32int blocks, 
+                                u32int probes, u32int h)
+{
+  const u32int * b = filter + h % blocks * filter_block_size;
+  u32int x = hash_mix(h);
+  u32int step = (x >> 23) | 1;
+  for (u32int i = 0; i != probes; ++i, x += step) {
+    u32int bit = x & 511;
+    if (!(b[bit >> 5] & (1u << (bit & 31)))) return false;
+  }
+  return true;
+}
+
+static inline void filter_add(u32int * filter, u32int blocks, 
+                              u32int probes, u32int h)
+{
+  u32int * b = filter + h % blocks * filter_block_size;
+  u32int x = hash_mix(h);
+  u32int step = (x >> 23) | 1;
+  for (u32int i = 0; i != probes; ++i, x += step) {
+    u32int bit = x & 511;
+    b[bit >> 5] |= 1u << (bit & 31);
+  }
+}
+
 namespace {
 
   using namespace aspell::sp;
@@ -224,15 +379,36 @@ namespace {
     u32int           mmaped_size;
     const Jump * jump1;
     const Jump * jump2;
-    WordLookup       word_lookup;
+    u32int           jump1_size;
+    WordLookup       word_lookup; // only used for older files
+    const WordBucket * buckets;   // 0 for older files
+    u32int           num_buckets;
+    u32int           word_count;
+    InsensitiveEqual word_equal;
     const char *     word_block;
     const char *     first_word;
+    u32int           filter_blocks; // 0 if there is no lookup filter
+    u32int           filter_probes;
+    const u32int *   filter;
+    u32int           del_buckets_size; // 0 if there is no deletion index
+    const u32int *   del_buckets;
+    const u32int *   del_items;
+    u32int           tri_buckets_size; // 0 if there is no trigram index
+    const u32int *   tri_buckets;
+    const u32int *   tri_items;
+    u32int           exp_size; // 0 if there is no expanded form index
+    const u32int *   exp_first;
+    const u32int *   exp_sls; // 4 values for each soundslike
+    const u32int *   exp_forms;
+    const char *     exp_strings;
     
     ReadOnlyDict(const ReadOnlyDict&);
     ReadOnlyDict& operator= (const ReadOnlyDict&);
 
     struct Elements;
     struct SoundslikeElements;
+    struct NeighborElements;
+    struct ExpandedElements;
 
   public:
     WordEntryEnumeration * detailed_elements() const;
@@ -258,6 +434,9 @@ namespace {
     PosibErr<void> check_hash_fun() const;
     void low_level_dump() const;
 
+    // returns 0 if the word is not found
+    const char * find(ParmString word) const;
+
     bool lookup(ParmString word, const SensitiveCompare *, WordEntry &) const;
 
     bool clean_lookup(ParmString, WordEntry &) const;
@@ -266,6 +445,12 @@ namespace {
     bool soundslike_lookup(ParmString, WordEntry &) const;
     
     SoundslikeEnumeration * soundslike_elements() const;
+    SoundslikeEnumeration * soundslike_elements(unsigned part, 
+                                                unsigned num) const;
+    SoundslikeEnumeration * soundslike_neighbors(ParmString sl) const;
+    SoundslikeEnumeration * soundslike_trigrams(ParmString sl) const;
+    SoundslikeEnumeration * expanded_elements(unsigned part, 
+                                              unsigned num) const;
 
   };
 
@@ -323,12 +508,12 @@ namespace {
       if (word_info) printf(" [WI: %d]", word_info);
       //if (flags & DUPLICATE_FLAG) printf(" [NEXT DUP]");
       const char * p = w;
-      WordLookup::const_iterator i = word_lookup.find(w);
+      const char * f = find(w);
       if (!next_dup) {
-        if (i == word_lookup.end())
+        if (f == 0)
           printf(" <BAD HASH>");
-        else if (word_block + *i != w) {
-          printf(" <BAD HASH, got %s>", word_block + *i);
+        else if (f != w) {
+          printf(" <BAD HASH, got %s>", f);
         }
         else 
           printf(" <hash ok>");
@@ -374,14 +559,17 @@ namespace {
   }
 
   ReadOnlyDict::Size ReadOnlyDict::size() const {
-    return word_lookup.size();
+    return word_count;
   }
   
   bool ReadOnlyDict::empty() const {
-    return word_lookup.empty();
+    return word_count == 0;
   }
 
-  static const char * const cur_check_word = "aspell default speller rowl 1.10";
+  static const char * const cur_check_word = "aspell default speller rowl 1.11";
+  // same layout except for the hash table and the header which ends
+  // before DataHead::sections
+  static const char * const old_check_word = "aspell default speller rowl 1.10";
 
   struct DataHead {
     // all sizes except the last four must to divisible by "align":
@@ -398,7 +586,7 @@ namespace {
     u32int hash_offset;
 
     u32int word_count;
-    u32int word_buckets;
+    u32int word_buckets; // 32 bit slots in "rowl 1.10" files
     u32int soundslike_count;
 
     u32int dict_name_size;
@@ -413,6 +601,16 @@ namespace {
     byte soundslike_root_only;
     byte compound_info; //
     byte freq_info;
+
+    // the optional sections which are present, not in "rowl 1.10"
+    // files which end before this field
+    u32int sections;
+    enum {
+      HAVE_LOOKUP_FILTER  = 1 << 0,
+      HAVE_DELETION_INDEX = 1 << 1,
+      HAVE_TRIGRAM_INDEX  = 1 << 2,
+      HAVE_EXPANDED_INDEX = 1 << 3
+    };
   };
 
   PosibErr<void> ReadOnlyDict::load(ParmString f0, Config & config, 
@@ -435,12 +633,18 @@ namespace {
     COUT << "Total Block Size: " << data_head.total_block_size << "\n";
 #endif
 
-    if (strcmp(data_head.check_word, cur_check_word) != 0)
+    bool old_hash_table = strcmp(data_head.check_word, old_check_word) == 0;
+    if (strcmp(data_head.check_word, cur_check_word) != 0 && !old_hash_table)
       return make_err(bad_file_format, fn);
 
     if (data_head.endian_check != 12345678)
       return make_err(bad_file_format, fn, _("Wrong endian order."));
 
+    if (old_hash_table) {
+      data_head.sections = 0;
+      f.seek(offsetof(DataHead, sections));
+    }
+
     CharVector word;
 
     word.resize(data_head.dict_name_size);
@@ -478,7 +682,10 @@ namespace {
 
     block_size = data_head.block_size;
     int offset = data_head.head_size;
-    mmaped_block = mmap_open(block_size + offset, f, 0);
+    if (config.retrieve_bool("use-mmap"))
+      mmaped_block = mmap_open(block_size + offset, f, 0);
+    else
+      mmaped_block = (char *)MAP_FAILED;
     if( mmaped_block != (char *)MAP_FAILED) {
       block = mmaped_block + offset;
       mmaped_size = block_size + offset;
@@ -489,10 +696,12 @@ namespace {
       f.read(block, block_size);
     }
 
+    jump1_size = 0;
     if (data_head.jump2_offset) {
       fast_scan = true;
       jump1 = reinterpret_cast<const Jump *>(block + data_head.jump1_offset);
       jump2 = reinterpret_cast<const Jump *>(block + data_head.jump2_offset);
+      while (jump1[jump1_size].sl[0]) ++jump1_size;
     } else {
       jump1 = jump2 = 0;
     }
@@ -500,16 +709,77 @@ namespace {
     word_block = block + data_head.word_offset;
     first_word = word_block + data_head.first_word_offset;
 
-    word_lookup.parms().block_begin = word_block;
-    word_lookup.parms().hash .lang     = lang();
-    word_lookup.parms().equal.cmp.lang = lang();
-    const u32int * begin = reinterpret_cast<const u32int *>
-      (block + data_head.hash_offset);
-    word_lookup.vector().set(begin, begin + data_head.word_buckets);
-    word_lookup.set_size(data_head.word_count);
+    word_count = data_head.word_count;
+    word_equal.cmp.lang = lang();
+    u32int sec_offset;
+    if (old_hash_table) {
+      buckets = 0;
+      num_buckets = 0;
+      word_lookup.parms().block_begin = word_block;
+      word_lookup.parms().hash .lang     = lang();
+      word_lookup.parms().equal.cmp.lang = lang();
+      const u32int * begin = reinterpret_cast<const u32int *>
+        (block + data_head.hash_offset);
+      word_lookup.vector().set(begin, begin + data_head.word_buckets);
+      word_lookup.set_size(data_head.word_count);
+      sec_offset = data_head.hash_offset + data_head.word_buckets * 4;
+    } else {
+      buckets = reinterpret_cast<const WordBucket *>
+        (block + data_head.hash_offset);
+      num_buckets = data_head.word_buckets;
+      sec_offset = data_head.hash_offset + num_buckets * sizeof(WordBucket);
+    }
+    sec_offset = (sec_offset + DataHead::align - 1)/DataHead::align*DataHead::align;
+
+    filter_blocks = filter_probes = 0;
+    filter = 0;
+    if (data_head.sections & DataHead::HAVE_LOOKUP_FILTER) {
+      const u32int * p = reinterpret_cast<const u32int *>(block + sec_offset);
+      filter_blocks = p[0];
+      filter_probes = p[1];
+      u32int begin = (offset + sec_offset + 8 + 63)/64*64 - offset;
+      filter = reinterpret_cast<const u32int *>(block + begin);
+      sec_offset = begin + filter_blocks * filter_block_size * 4;
+      sec_offset = (sec_offset + DataHead::align - 1)/DataHead::align*DataHead::align;
+    }
+
+    del_buckets_size = 0;
+    del_buckets = del_items = 0;
+    if (data_head.sections & DataHead::HAVE_DELETION_INDEX) {
+      const u32int * p = reinterpret_cast<const u32int *>(block + sec_offset);
+      del_buckets_size = p[0];
+      del_buckets = p + 2;
+      del_items = del_buckets + del_buckets_size + 1;
+      sec_offset += (2 + del_buckets_size + 1 + del_buckets[del_buckets_size]) * 4;
+      sec_offset = (sec_offset + DataHead::align - 1)/DataHead::align*DataHead::align;
+    }
+
+    tri_buckets_size = 0;
+    tri_buckets = tri_items = 0;
+    if (data_head.sections & DataHead::HAVE_TRIGRAM_INDEX) {
+      const u32int * p = reinterpret_cast<const u32int *>(block + sec_offset);
+      tri_buckets_size = p[0];
+      tri_buckets = p + 2;
+      tri_items = tri_buckets + tri_buckets_size + 1;
+      sec_offset += (2 + tri_buckets_size + 1 + tri_buckets[tri_buckets_size]) * 4;
+      sec_offset = (sec_offset + DataHead::align - 1)/DataHead::align*DataHead::align;
+    }
+
+    exp_size = 0;
+    exp_first = exp_sls = exp_forms = 0;
+    exp_strings = 0;
+    if (data_head.sections & DataHead::HAVE_EXPANDED_INDEX) {
+      const u32int * p = reinterpret_cast<const u32int *>(block + sec_offset);
+      exp_size = p[0];
+      exp_first = p + 2;
+      exp_sls = exp_first + exp_size + 1;
+      exp_forms = exp_sls + exp_size * 4;
+      exp_strings = reinterpret_cast<const char *>(exp_forms + p[1] * 2);
+    }
     
     //low_level_dump();
-    RET_ON_ERR(check_hash_fun());
+    if (old_hash_table)
+      RET_ON_ERR(check_hash_fun());
     
     return no_err;
   }
@@ -541,13 +811,39 @@ namespace {
     prep_next(wi, w, c, orig);
   }
 
+  const char * ReadOnlyDict::find(ParmString word) const
+  {
+    if (!buckets) {
+      if (filter_blocks && !filter_maybe(filter, filter_blocks, filter_probes, 
+                                         word_hash(lang(), word)))
+        return 0;
+      WordLookup::const_iterator i = word_lookup.find(word);
+      if (i == word_lookup.end()) return 0;
+      return word_block + *i;
+    }
+    u32int h = word_hash(lang(), word);
+    if (filter_blocks && !filter_maybe(filter, filter_blocks, filter_probes, h))
+      return 0;
+    u16int tag = word_tag(h);
+    const WordBucket * b = buckets + h % num_buckets;
+    for (;;) {
+      for (unsigned i = 0; i != WordBucket::size; ++i) {
+        if (b->tag[i] != tag) continue;
+        const char * w = word_block + b->offset[i];
+        if (word_equal(word, w)) return w;
+      }
+      if (!b->overflow) return 0;
+      ++b;
+      if (b == buckets + num_buckets) b = buckets;
+    }
+  }
+
   bool ReadOnlyDict::lookup(ParmString word, const SensitiveCompare * c,
                             WordEntry & o) const 
   {
     o.clear();
-    WordLookup::const_iterator i = word_lookup.find(word);
-    if (i == word_lookup.end()) return false;
-    const char * w = word_block + *i;
+    const char * w = find(word);
+    if (!w) return false;
     for (;;) {
       if ((*c)(word, w)) {
         convert(w,o);
@@ -566,6 +862,7 @@ namespace {
     const ReadOnlyDict * obj;
     const Jump * jump1;
     const Jump * jump2;
+    const Jump * jump1_end;
     const char * cur;
     const char * prev;
     int level;
@@ -574,9 +871,19 @@ namespace {
     WordEntry * next(int stopped_at);
 
     SoundslikeElements(const ReadOnlyDict * o)
-      : obj(o), jump1(obj->jump1), jump2(obj->jump2), cur(0), 
+      : obj(o), jump1(obj->jump1), jump2(obj->jump2), 
+        jump1_end(obj->jump1 + obj->jump1_size), cur(0), 
         level(1), invisible_soundslike(o->invisible_soundslike) {
       data.what = o->invisible_soundslike ? WordEntry::Word : WordEntry::Soundslike;}
+
+    // Only return the elements under jump1[begin .. end).  When
+    // begin > 0 the first element returned is the jump1 entry itself,
+    // just as if it was reached by advancing from the previous entry.
+    SoundslikeElements(const ReadOnlyDict * o, u32int begin, u32int end)
+      : obj(o), jump1(obj->jump1 + begin), jump2(obj->jump2), 
+        jump1_end(obj->jump1 + end), cur(0), 
+        level(begin == 0 ? 1 : 0), invisible_soundslike(o->invisible_soundslike) {
+      data.what = o->invisible_soundslike ? WordEntry::Word : WordEntry::Soundslike;}
   };
 
   WordEntry * ReadOnlyDict::SoundslikeElements::next(int stopped_at) {
@@ -589,7 +896,13 @@ namespace {
     const char * tmp = cur;
     const char * p;
 
-    if (level == 1 && stopped_at < 2) {
+    if (level == 0) {
+
+      level = 1;
+      tmp = jump1->sl;
+      goto jquit;
+
+    } else if (level == 1 && stopped_at < 2) {
 
       ++jump1;
       tmp = jump1->sl;
@@ -668,7 +981,7 @@ namespace {
 
   jquit:
     prev = 0;
-    if (!*tmp) return 0;
+    if (!*tmp || jump1 >= jump1_end) return 0;
     data.word = tmp;
     data.word_size = !tmp[1] ? 1 : !tmp[2] ? 2 : 3;
     data.intr[0] = 0;
@@ -684,7 +997,195 @@ namespace {
     return new SoundslikeElements(this);
 
   }
+
+  // Returns the offset into the data block of the first element
+  // under jump1[i]
+  static inline u32int jump1_loc(const Jump * jump1, const Jump * jump2, 
+                                 u32int i) {
+    return jump2[jump1[i].loc].loc;
+  }
+
+  SoundslikeEnumeration * ReadOnlyDict::soundslike_elements(unsigned part,
+                                                            unsigned num) const 
+  {
+    if (!jump1 || num == 0 || part >= num) return 0;
+    // split on jump1 boundaries so that each part covers roughly the
+    // same amount of the data block
+    u32int total = jump1_size ? jump1_loc(jump1, jump2, jump1_size - 1) : 0;
+    u32int begin = 0, end = jump1_size;
+    for (unsigned i = 0; i != 2; ++i) {
+      u32int & res = i == 0 ? begin : end;
+      unsigned p = part + i;
+      if (p == 0 || p == num) continue;
+      u32int target = (u32int)((double)total * p / num);
+      u32int lo = 0, hi = jump1_size;
+      while (lo < hi) {
+        u32int mid = lo + (hi - lo)/2;
+        if (jump1_loc(jump1, jump2, mid) < target) lo = mid + 1;
+        else hi = mid;
+      }
+      res = lo;
+    }
+    return new SoundslikeElements(this, begin, end);
+  }
     
+  struct ReadOnlyDict::NeighborElements : public SoundslikeEnumeration
+  {
+    WordEntry data;
+    const ReadOnlyDict * obj;
+    Vector<u32int> items;
+    Vector<u32int>::const_iterator cur;
+
+    // stopped_at is ignored as the items have already been narrowed
+    // down
+    WordEntry * next(int) {
+      if (cur == items.end()) return 0;
+      const char * tmp = obj->word_block + *cur;
+      ++cur;
+      data.word = tmp;
+      data.word_size = get_word_size(tmp);
+      if (obj->invisible_soundslike) {
+        convert(tmp, data);
+      }
+      data.intr[0] = (void *)tmp;
+      return &data;
+    }
+
+    NeighborElements(const ReadOnlyDict * o) : obj(o) {
+      data.what = o->invisible_soundslike ? WordEntry::Word : WordEntry::Soundslike;}
+  };
+
+  SoundslikeEnumeration * ReadOnlyDict::soundslike_neighbors(ParmString sl) const
+  {
+    if (del_buckets_size == 0) return 0;
+    NeighborElements * els = new NeighborElements(this);
+    const char * b = sl;
+    const char * e = b + sl.size();
+    // the soundslike itself and then with each character deleted,
+    // when the same character is repeated only the first one needs to
+    // be deleted
+    for (const char * skip = 0; skip != e; skip = skip ? skip + 1 : b) {
+      if (skip && skip != b && skip[-1] == *skip) continue;
+      u32int h = deletion_hash(b, e, skip) % del_buckets_size;
+      els->items.insert(els->items.end(), 
+                        del_items + del_buckets[h], 
+                        del_items + del_buckets[h + 1]);
+    }
+    std::sort(els->items.begin(), els->items.end());
+    els->items.erase(std::unique(els->items.begin(), els->items.end()), 
+                     els->items.end());
+    els->cur = els->items.begin();
+    return els;
+  }
+
+  SoundslikeEnumeration * ReadOnlyDict::soundslike_trigrams(ParmString sl) const
+  {
+    if (tri_buckets_size == 0 || sl.size() < 3) return 0;
+    NeighborElements * els = new NeighborElements(this);
+    for (const char * p = sl, * e = sl + sl.size() - 2; p != e; ++p) {
+      u32int h = trigram_hash(p) % tri_buckets_size;
+      els->items.insert(els->items.end(), 
+                        tri_items + tri_buckets[h], 
+                        tri_items + tri_buckets[h + 1]);
+    }
+    std::sort(els->items.begin(), els->items.end());
+    els->items.erase(std::unique(els->items.begin(), els->items.end()), 
+                     els->items.end());
+    els->cur = els->items.begin();
+    return els;
+  }
+
+  struct ReadOnlyDict::ExpandedElements : public SoundslikeEnumeration
+  {
+    WordEntry data;
+    const ReadOnlyDict * obj;
+    u32int cur;
+    u32int end;
+    bool started;
+    ObjStack buf; // holds the last form made by set_form
+
+    WordEntry * next(int stopped_at) {
+      // the soundslikes which share every character up to and
+      // including stopped_at with the last one returned can not be
+      // any closer
+      if (started && stopped_at >= 0) {
+        if (stopped_at < 3) {
+          u32int n = obj->exp_sls[(cur - 1) * 4 + 1 + stopped_at];
+          if (n > cur) cur = n;
+        } else {
+          while (cur < end && shared(cur) > stopped_at) ++cur;
+        }
+      }
+      if (cur >= end) return 0;
+      started = true;
+      const char * sl = obj->exp_strings + obj->exp_sls[cur * 4] + 1;
+      data.word = sl;
+      data.word_size = strlen(sl);
+      data.intr[0] = (void *)(obj->exp_forms + obj->exp_first[cur] * 2);
+      data.intr[1] = (void *)(obj->exp_forms + obj->exp_first[cur + 1] * 2);
+      data.intr[2] = (void *)this;
+      ++cur;
+      return &data;
+    }
+
+    // the size of the prefix shared with the previous soundslike,
+    // stored just before the soundslike
+    int shared(u32int i) const {
+      return (byte)obj->exp_strings[obj->exp_sls[i * 4]];
+    }
+
+    // sets w to the form the index entry f refers to, returns false
+    // if there is no such form
+    bool set_form(const u32int * f, WordEntry & w);
+
+    ExpandedElements(const ReadOnlyDict * o, u32int b, u32int e) 
+      : obj(o), cur(b), end(e), started(false), buf(1024) {
+      data.what = WordEntry::Soundslike;}
+  };
+
+  bool ReadOnlyDict::ExpandedElements::set_form(const u32int * f, WordEntry & w)
+  {
+    const char * word = obj->word_block + f[0];
+    convert(word, w);
+    if (f[1] == 0) {
+      w.aff = "";
+      return true;
+    }
+    buf.reset();
+    WordAff * l = obj->lang()->affix()->expand_suffix
+      (ParmString(w.word, w.word_size), (const byte *)w.aff, buf);
+    for (u32int i = 1; l && i != f[1]; ++i) l = l->next;
+    if (!l) return false;
+    w.word = l->word.str;
+    w.word_size = l->word.size;
+    w.aff = "";
+    w.word_info = 0;
+    return true;
+  }
+
+  static void expanded_next(WordEntry * w)
+  {
+    const u32int * cur = (const u32int *)(w->intr[0]);
+    const u32int * end = (const u32int *)(w->intr[1]);
+    ReadOnlyDict::ExpandedElements * els 
+      = (ReadOnlyDict::ExpandedElements *)(w->intr[2]);
+    w->word = 0;
+    for (; cur != end; cur += 2) {
+      if (els->set_form(cur, *w)) {cur += 2; break;}
+    }
+    w->intr[0] = (void *)cur;
+    if (cur == end) w->adv_ = 0;
+  }
+
+  SoundslikeEnumeration * ReadOnlyDict::expanded_elements(unsigned part,
+                                                          unsigned num) const
+  {
+    if (exp_size == 0 || num == 0 || part >= num) return 0;
+    u32int begin = (u32int)((double)exp_size * part / num);
+    u32int end   = (u32int)((double)exp_size * (part + 1) / num);
+    return new ExpandedElements(this, begin, end);
+  }
+
   static void soundslike_next(WordEntry * w)
   {
     const char * cur = (const char *)(w->intr[0]);
@@ -706,9 +1207,8 @@ namespace {
   bool ReadOnlyDict::clean_lookup(ParmString sl, WordEntry & o) const
   {
     o.clear();
-    WordLookup::const_iterator i = word_lookup.find(sl);
-    if (i == word_lookup.end()) return false;
-    const char * w = word_block + *i;
+    const char * w = find(sl);
+    if (!w) return false;
     convert(w, o);
     if (duplicate_flag(w)) o.adv_ = clean_lookup_adv;
     return true;
@@ -720,6 +1220,18 @@ namespace {
 
       return false;
 
+    } else if (s.intr[2]) {
+
+      // from expanded_elements()
+      w.clear();
+      w.what = WordEntry::Word;
+      w.intr[0] = s.intr[0];
+      w.intr[1] = s.intr[1];
+      w.intr[2] = s.intr[2];
+      w.adv_ = expanded_next;
+      expanded_next(&w);
+      return w.word != 0;
+
     } else if (!invisible_soundslike) {
       
       w.clear();
@@ -786,6 +1298,8 @@ namespace {
     byte sl_size;
     byte data_size;
     byte flags;
+    u32int chunk; // the chunk of the word list the word came from
+    u32int num;   // and its position within that chunk
     char word[1];
   };
 
@@ -800,24 +1314,49 @@ namespace {
       if (res != 0) return res < 0;
       res = icomp(x->word, y->word);
       if (res != 0) return res < 0;
-      return strcmp(x->word, y->word) < 0;
+      res = strcmp(x->word, y->word);
+      if (res != 0) return res < 0;
+      // keep identical words in the order they were read so that the
+      // result does not depend on how the list was divided up
+      if (x->chunk != y->chunk) return x->chunk < y->chunk;
+      return x->num < y->num;
     }
   };
 
-  struct WordLookupParms {
+  // builds the hash table described at the top of this file
+  struct WordTable {
+    Vector<WordBucket> buckets;
     const char * block_begin;
-    WordLookupParms() {}
-    typedef aspell::Vector<u32int> Vector;
-    typedef u32int                 Value;
-    typedef const char *           Key;
-    static const bool is_multi = false;
-    Key key(Value v) const {return block_begin + v;}
-    InsensitiveHash<hash_int_t> hash;
     InsensitiveEqual equal;
-    bool is_nonexistent(Value v) const {return v == u32int_max;}
-    void make_nonexistent(Value & v) const {v = u32int_max;}
+    WordTable(u32int num_words, const LangImpl * lang, const char * b)
+      : buckets(num_words / 8 + 1), block_begin(b), equal(lang) 
+    {
+      memset(buckets.data(), 0, buckets.size() * sizeof(WordBucket));
+    }
+    // does nothing if an equal word is already in the table
+    void insert(u32int pos, u32int h);
   };
-  typedef VectorHashTable<WordLookupParms> WordLookup;
+
+  void WordTable::insert(u32int pos, u32int h)
+  {
+    u16int tag = word_tag(h);
+    WordBucket * b = buckets.data() + h % buckets.size();
+    for (;;) {
+      for (unsigned i = 0; i != WordBucket::size; ++i) {
+        if (b->tag[i] == 0) {
+          b->tag[i] = tag;
+          b->offset[i] = pos;
+          return;
+        }
+        if (b->tag[i] == tag && 
+            equal(block_begin + b->offset[i], block_begin + pos))
+          return;
+      }
+      b->overflow = 1;
+      ++b;
+      if (b == buckets.data() + buckets.size()) b = buckets.data();
+    }
+  }
 
   static inline unsigned int round_up(unsigned int i, unsigned int size) {
     return ((i + size - 1)/size)*size;
@@ -830,12 +1369,364 @@ namespace {
       out << '\0';
   }
 
+  // for now the hash is stored in place of the bucket, which is
+  // filled in by write_deletion_index once the number of buckets is
+  // known
+  static void add_deletions(Vector<pair<u32int, u32int> > & res, 
+                            const char * sl, u32int pos) 
+  {
+    const char * e = sl + strlen(sl);
+    for (const char * skip = 0; skip != e; skip = skip ? skip + 1 : sl) {
+      if (skip && skip != sl && skip[-1] == *skip) continue;
+      res.push_back(pair<u32int, u32int>(deletion_hash(sl, e, skip), pos));
+    }
+  }
+
+  // likewise for the trigram index
+  static void add_trigrams(Vector<pair<u32int, u32int> > & res, 
+                           const char * sl, u32int pos) 
+  {
+    for (; sl[0] && sl[1] && sl[2]; ++sl)
+      res.push_back(pair<u32int, u32int>(trigram_hash(sl), pos));
+  }
+
+  // writes the (hash, offset) pairs in items as size buckets laid out
+  // as described for the deletion index at the top of this file
+  static void write_buckets(FStream & out, 
+                            Vector<pair<u32int, u32int> > & items,
+                            u32int size)
+  {
+    for (Vector<pair<u32int, u32int> >::iterator i = items.begin(); 
+         i != items.end(); ++i)
+      i->first %= size;
+    std::sort(items.begin(), items.end());
+    items.erase(std::unique(items.begin(), items.end()), items.end());
+    Vector<u32int> buckets(size + 3);
+    buckets[0] = size;
+    buckets[1] = 0;
+    Vector<pair<u32int, u32int> >::const_iterator i = items.begin();
+    for (u32int b = 0; b <= size; ++b) {
+      while (i != items.end() && i->first < b) ++i;
+      buckets[b + 2] = i - items.begin();
+    }
+    out.write(buckets.data(), buckets.size() * 4);
+    Vector<u32int> offsets;
+    offsets.reserve(items.size());
+    for (i = items.begin(); i != items.end(); ++i)
+      offsets.push_back(i->second);
+    if (!offsets.empty())
+      out.write(offsets.data(), offsets.size() * 4);
+  }
+
+  static void write_deletion_index(FStream & out, 
+                                   Vector<pair<u32int, u32int> > & items)
+  {
+    // about four items in each bucket is a good balance between the
+    // size of the index and the number of false candidates
+    write_buckets(out, items, items.size() / 4 + 1);
+  }
+
+  static void write_trigram_index(FStream & out, 
+                                  Vector<pair<u32int, u32int> > & items)
+  {
+    // there are far fewer trigrams than items, so use about twice as
+    // many buckets as there are trigrams to keep each trigram in a
+    // bucket of its own most of the time
+    Vector<u32int> hashes;
+    hashes.reserve(items.size());
+    for (Vector<pair<u32int, u32int> >::const_iterator i = items.begin(); 
+         i != items.end(); ++i)
+      hashes.push_back(i->first);
+    std::sort(hashes.begin(), hashes.end());
+    u32int num = std::unique(hashes.begin(), hashes.end()) - hashes.begin();
+    write_buckets(out, items, num * 2 + 1);
+  }
+
+  struct ExpandedForm {
+    const char * sl;
+    u32int pos; // the offset of the word in the data block
+    u32int num; // the form number, see the top of this file
+  };
+
+  struct ExpandedFormLess {
+    bool operator() (const ExpandedForm & x, const ExpandedForm & y) const {
+      int res = strcmp(x.sl, y.sl);
+      if (res != 0) return res < 0;
+      if (x.pos != y.pos) return x.pos < y.pos;
+      return x.num < y.num;
+    }
+  };
+
+  // adds the word at pos and every form made by adding suffixes to it
+  static void add_forms(Vector<ExpandedForm> & forms, 
+                        const LangImpl & lang, const WordData * p, u32int pos,
+                        ObjStack & sls, ObjStack & exp_buf, String & sl_buf)
+  {
+    ExpandedForm f;
+    f.sl = p->sl;
+    f.pos = pos;
+    f.num = 0;
+    forms.push_back(f);
+    if (!p->aff) return;
+    exp_buf.reset();
+    WordAff * l = lang.affix()->expand_suffix(ParmString(p->word, p->word_size), 
+                                              (const byte *)p->aff, exp_buf);
+    for (; l; l = l->next) {
+      lang.to_soundslike(sl_buf, l->word);
+      f.sl = sls.dup(sl_buf);
+      ++f.num;
+      forms.push_back(f);
+    }
+  }
+
+  static PosibErr<void> write_expanded_index(FStream & out, 
+                                             Vector<ExpandedForm> & forms)
+  {
+    if (forms.size() > u32int_max)
+      return make_err(other_error, 
+                      _("Too many expanded forms for the expanded-index."));
+    std::sort(forms.begin(), forms.end(), ExpandedFormLess());
+    Vector<u32int> first;
+    Vector<u32int> sls;
+    Vector<byte>   shared;
+    Vector<u32int> items;
+    String strings;
+    items.reserve(forms.size() * 2);
+    const char * prev = 0;
+    for (Vector<ExpandedForm>::const_iterator i = forms.begin(); 
+         i != forms.end(); ++i) 
+    {
+      if (!prev || strcmp(prev, i->sl) != 0) {
+        unsigned s = 0;
+        if (prev) 
+          while (prev[s] && prev[s] == i->sl[s]) ++s;
+        if (s > 255) s = 255;
+        first.push_back(i - forms.begin());
+        sls.push_back(strings.size());
+        sls.push_back(0);
+        sls.push_back(0);
+        sls.push_back(0);
+        shared.push_back(s);
+        strings += (char)s;
+        strings += i->sl;
+        strings += '\0';
+        prev = i->sl;
+      }
+      items.push_back(i->pos);
+      items.push_back(i->num);
+    }
+    first.push_back(forms.size());
+    // fill in the links to the next soundslike not sharing the first
+    // k + 1 characters, working backwards
+    u32int num = shared.size();
+    for (unsigned k = 0; k != 3; ++k) {
+      u32int next = num;
+      for (u32int i = num; i-- > 0;) {
+        sls[i * 4 + 1 + k] = next;
+        if (shared[i] <= k) next = i;
+      }
+    }
+    u32int head[2] = {num, static_cast<u32int>(forms.size())};
+    out.write(head, 8);
+    out.write(first.data(), first.size() * 4);
+    if (!sls.empty()) {
+      out.write(sls.data(), sls.size() * 4);
+      out.write(items.data(), items.size() * 4);
+      out.write(strings.data(), strings.size());
+    }
+    return no_err;
+  }
+
+  // The word list is divided into chunks of lines which are expanded
+  // and sorted independently, possibly in different threads, and then
+  // merged.
+
+  static const unsigned chunk_lines = 8192;
+
+  class LineEnumeration : public StringEnumeration {
+    const char * const * i;
+    const char * const * end;
+  public:
+    LineEnumeration() : i(0), end(0) {}
+    void set(const Vector<const char *> & lines) {
+      i = lines.pbegin();
+      end = lines.pend();
+    }
+    StringEnumeration * clone() const {
+      return new LineEnumeration(*this);
+    }
+    void assign(const StringEnumeration * other) {
+      *this = *static_cast<const LineEnumeration *>(other);
+    }
+    Value next() {
+      if (i == end) return 0;
+      return *i++;
+    }
+    bool at_end() const {return i == end;}
+  };
+
+  struct ReadChunk : public ParallelJob {
+    const LangImpl * lang;
+    bool affix_compress;
+    bool partially_expand;
+    u32int chunk;
+    ObjStack line_buf;
+    Vector<const char *> lines;
+    LineEnumeration lines_els;
+    String log;
+    WordListIterator wl_itr;
+    ObjStack buf;
+    WordData * first;
+    PosibErr<void> err;
+    ReadChunk(const LangImpl * l, bool ac, bool pe, u32int c, bool warn)
+      : lang(l), affix_compress(ac), partially_expand(pe), chunk(c), 
+        line_buf(16*1024), wl_itr(&lines_els, l, warn ? &log : 0),
+        buf(16*1024), first(0) {}
+    void add_line(const char * line) {lines.push_back(line_buf.dup(line));}
+    PosibErr<void> init(Config & config) {
+      lines_els.set(lines);
+      return wl_itr.init(config);
+    }
+    PosibErr<void> read();
+    void run();
+  };
+
+  PosibErr<void> ReadChunk::read()
+  {
+    ObjStack exp_buf;
+    WordAff * exp_list;
+    WordAff single;
+    single.next = 0;
+    String sl_buf;
+    WordData * * prev = &first;
+    u32int num = 0;
+
+    for (;;) {
+
+      PosibErr<bool> pe = wl_itr.adv();
+      if (pe.has_err()) return pe;
+      if (!pe.data) break;
+
+      const char * w = wl_itr->word.str;
+      unsigned int s = wl_itr->word.size;
+
+      const char * affixes = wl_itr->aff.str;
+
+      if (*affixes && !lang->affix())
+        return make_err(other_error, 
+                        _("Affix flags found in word but no affix file given."));
+
+      if (*affixes && !affix_compress) {
+        exp_buf.reset();
+        exp_list = lang->affix()->expand(w, affixes, exp_buf);
+      } else if (*affixes && partially_expand) {
+        // expand any affixes which will effect the first
+        // 3 letters of a word.  This is needed so that the
+        // jump tables will function correctly
+        exp_buf.reset();
+        exp_list = lang->affix()->expand(w, affixes, exp_buf, 3);
+      } else {
+        single.word.str = w;
+        single.word.size = strlen(w);
+        single.aff = (const byte *)affixes;
+        exp_list = &single;
+      }
+
+      // iterate through each expanded word
+        
+      for (WordAff * p = exp_list; p; p = p->next)
+      {
+        const char * w = p->word.str;
+        s = p->word.size;
+          
+        unsigned total_size = WordData::struct_size;
+        unsigned data_size = s + 1;
+        unsigned aff_size = strlen((const char *)p->aff);
+        if (aff_size > 0) data_size += aff_size + 1;
+        total_size += data_size;
+        lang->to_soundslike(sl_buf, w);
+        const char * sl = sl_buf.str();
+        unsigned sl_size = sl_buf.size();
+        if (strcmp(sl,w) == 0) sl = w;
+        if (sl != w) total_size += sl_size + 1;
+
+        if (total_size - WordData::struct_size > 240)
+          return make_err(invalid_word, MsgConv(lang)(w),
+                          _("The total word length, with soundslike data, is larger than 240 characters."));
+
+        WordData * b = (WordData *)buf.alloc(total_size, sizeof(void *));
+        *prev = b;
+        b->next = 0;
+        prev = &b->next;
+          
+        b->word_size = s;
+        b->sl_size = strlen(sl);
+        b->data_size = data_size;
+        b->flags = lang->get_word_info(w);
+        b->chunk = chunk;
+        b->num = num++;
+
+        char * z = b->word;
+
+        memcpy(z, w, s + 1);
+        z += s + 1;
+
+        if (aff_size > 0) {
+          b->flags |= HAVE_AFFIX_FLAG;
+          b->aff = z;
+          memcpy(z, p->aff, aff_size + 1);
+          z += aff_size + 1;
+        } else {
+          b->aff = 0;
+        }
+
+        if (sl != w) {
+          memcpy(z, sl, sl_size + 1);
+          b->sl = z;
+        } else {
+          b->sl = b->word;
+        }
+
+      }
+    }
+    return no_err;
+  }
+
+  void ReadChunk::run()
+  {
+    err = read();
+    // the words have been copied so the lines are no longer needed
+    lines.clear();
+    line_buf.reset();
+    if (!err.has_err())
+      first = sort(first, SoundslikeLess(lang));
+  }
+
+  struct MergeJob : public ParallelJob {
+    SoundslikeLess lt;
+    WordData * x;
+    WordData * y;
+    MergeJob(const LangImpl * l, WordData * x0, WordData * y0)
+      : lt(l), x(x0), y(y0) {}
+    void run() {
+      if (!x) x = y;
+      else if (y) x = merge(x, y, lt, Next<WordData>());
+    }
+  };
+
+  struct ReadChunks : public Vector<ReadChunk *> {
+    ~ReadChunks() {
+      for (iterator i = begin(); i != end(); ++i) delete *i;
+    }
+  };
+
   PosibErr<void> create (StringEnumeration * els,
 			 const LangImpl & lang,
                          Config & config) 
   {
     assert(sizeof(u16int) == 2);
     assert(sizeof(u32int) == 4);
+    assert(sizeof(WordBucket) == 64);
 
     bool full_soundslike = !(strcmp(lang.soundslike_name(), "none") == 0 ||
                              strcmp(lang.soundslike_name(), "stripped") == 0 ||
@@ -848,6 +1739,13 @@ namespace {
                              !full_soundslike &&
                              config.retrieve_bool("partially-expand"));
 
+    bool deletion_index = (!affix_compress && 
+                           config.retrieve_bool("deletion-index"));
+
+    bool lookup_filter = config.retrieve_bool("lookup-filter");
+
+    bool trigram_index = config.retrieve_bool("trigram-index");
+
     bool invisible_soundslike = false;
     if (partially_expand)
       invisible_soundslike = true;
@@ -856,6 +1754,11 @@ namespace {
     else if (!full_soundslike)
       invisible_soundslike = true;
 
+    // the forms with suffixes are only scanned for when the
+    // dictionary is partially expanded, otherwise only the roots are
+    bool expanded_index = (partially_expand &&
+                           config.retrieve_bool("expanded-index"));
+
     ConvEC iconv;
     if (!config.have("norm-strict"))
       config.replace("norm-strict", "true");
@@ -886,6 +1789,10 @@ namespace {
     data_head.affix_info = affix_compress ? partially_expand ? 1 : 2 : 0;
     data_head.invisible_soundslike = invisible_soundslike;
     data_head.soundslike_root_only = affix_compress  && !partially_expand ? 1 : 0;
+    if (lookup_filter)  data_head.sections |= DataHead::HAVE_LOOKUP_FILTER;
+    if (deletion_index) data_head.sections |= DataHead::HAVE_DELETION_INDEX;
+    if (trigram_index)  data_head.sections |= DataHead::HAVE_TRIGRAM_INDEX;
+    if (expanded_index) data_head.sections |= DataHead::HAVE_EXPANDED_INDEX;
 
 #if 0
     CERR.printl("FLAGS:  ");
@@ -902,118 +1809,77 @@ namespace {
     int num_entries = 0;
     int uniq_entries = 0;
     
-    ObjStack buf(16*1024);
-    String sl_buf;
-
     WordData * first = 0;
 
     //
     // Read in Wordlist
     //
+    ReadChunks chunks;
     {
-      WordListIterator wl_itr(els, &lang, config.retrieve_bool("warn") ? &CERR : 0);
-      wl_itr.init(config);
-      ObjStack exp_buf;
-      WordAff * exp_list;
-      WordAff single;
-      single.next = 0;
-      Vector<WordAff> af_list;
-      WordData * * prev = &first;
-
-      for (;;) {
-
-        PosibErr<bool> pe = wl_itr.adv();
-        if (pe.has_err()) return pe;
-        if (!pe.data) break;
-
-        const char * w = wl_itr->word.str;
-        unsigned int s = wl_itr->word.size;
-
-        const char * affixes = wl_itr->aff.str;
-
-        if (*affixes && !lang.affix())
-          return make_err(other_error, 
-                          _("Affix flags found in word but no affix file given."));
-
-        if (*affixes && !affix_compress) {
-          exp_buf.reset();
-          exp_list = lang.affix()->expand(w, affixes, exp_buf);
-        } else if (*affixes && partially_expand) {
-          // expand any affixes which will effect the first
-          // 3 letters of a word.  This is needed so that the
-          // jump tables will function correctly
-          exp_buf.reset();
-          exp_list = lang.affix()->expand(w, affixes, exp_buf, 3);
-        } else {
-          single.word.str = w;
-          single.word.size = strlen(w);
-          single.aff = (const byte *)affixes;
-          exp_list = &single;
+      bool warn = config.retrieve_bool("warn");
+      ReadChunk * c = 0;
+      const char * line;
+      while ((line = els->next()) != 0) {
+        if (!c || c->lines.size() == chunk_lines) {
+          c = new ReadChunk(&lang, affix_compress, partially_expand, 
+                            chunks.size(), warn);
+          chunks.push_back(c);
         }
+        c->add_line(line);
+      }
+      delete els;
+    }
 
-        // iterate through each expanded word
-        
-        for (WordAff * p = exp_list; p; p = p->next)
-        {
-          const char * w = p->word.str;
-          s = p->word.size;
-          
-          unsigned total_size = WordData::struct_size;
-          unsigned data_size = s + 1;
-          unsigned aff_size = strlen((const char *)p->aff);
-          if (aff_size > 0) data_size += aff_size + 1;
-          total_size += data_size;
-          lang.to_soundslike(sl_buf, w);
-          const char * sl = sl_buf.str();
-          unsigned sl_size = sl_buf.size();
-          if (strcmp(sl,w) == 0) sl = w;
-          if (sl != w) total_size += sl_size + 1;
-
-          if (total_size - WordData::struct_size > 240)
-            return make_err(invalid_word, MsgConv(lang)(w),
-                            _("The total word length, with soundslike data, is larger than 240 characters."));
-
-          WordData * b = (WordData *)buf.alloc(total_size, sizeof(void *));
-          *prev = b;
-          b->next = 0;
-          prev = &b->next;
-          
-          b->word_size = s;
-          b->sl_size = strlen(sl);
-          b->data_size = data_size;
-          b->flags = lang.get_word_info(w);
-
-          char * z = b->word;
-
-          memcpy(z, w, s + 1);
-          z += s + 1;
-
-          if (aff_size > 0) {
-            b->flags |= HAVE_AFFIX_FLAG;
-            b->aff = z;
-            memcpy(z, p->aff, aff_size + 1);
-            z += aff_size + 1;
-          } else {
-            b->aff = 0;
-          }
-
-          if (sl != w) {
-            memcpy(z, sl, sl_size + 1);
-            b->sl = z;
-          } else {
-            b->sl = b->word;
-          }
+    //
+    // expand and sort each chunk
+    //
 
-        }
+    unsigned threads = config.retrieve_int("create-threads");
+    {
+      Vector<ParallelJob *> jobs;
+      for (ReadChunks::iterator i = chunks.begin(); i != chunks.end(); ++i) {
+        RET_ON_ERR((*i)->init(config));
+        jobs.push_back(*i);
+      }
+      if (!jobs.empty())
+        run_parallel(jobs.pbegin(), jobs.size(), threads);
+    }
+    
+    // report any warnings in the order they would have been given if
+    // the word list was read in one piece, stopping at the first error
+    for (ReadChunks::iterator i = chunks.begin(); i != chunks.end(); ++i) {
+      if (!(*i)->log.empty()) CERR.write((*i)->log);
+      if ((*i)->err.has_err()) {
+        for (ReadChunks::iterator j = i + 1; j != chunks.end(); ++j)
+          (*j)->err.ignore_err();
+        return (*i)->err;
       }
-      delete els;
     }
 
     //
-    // sort WordData linked list based on (sl, word)
+    // merge the chunks into a single list sorted on (sl, word)
     //
 
-    first = sort(first, SoundslikeLess(&lang));
+    {
+      Vector<WordData *> lists;
+      for (ReadChunks::iterator i = chunks.begin(); i != chunks.end(); ++i)
+        lists.push_back((*i)->first);
+      while (lists.size() > 1) {
+        Vector<MergeJob> merges;
+        for (unsigned i = 0; i + 1 < lists.size(); i += 2)
+          merges.push_back(MergeJob(&lang, lists[i], lists[i+1]));
+        Vector<ParallelJob *> jobs;
+        for (Vector<MergeJob>::iterator j = merges.begin(); j != merges.end(); ++j)
+          jobs.push_back(&*j);
+        run_parallel(jobs.pbegin(), jobs.size(), threads);
+        Vector<WordData *> merged;
+        for (Vector<MergeJob>::iterator j = merges.begin(); j != merges.end(); ++j)
+          merged.push_back(j->x);
+        if (lists.size() % 2 == 1) merged.push_back(lists.back());
+        lists.swap(merged);
+      }
+      if (!lists.empty()) first = lists[0];
+    }
 
     //
     // duplicate check
@@ -1091,16 +1957,30 @@ namespace {
     data.write32(0);
     unsigned prev_w_pos = data.size();
 
-    WordLookup lookup(affix_compress 
-                      ? uniq_entries * 3 / 2 
-                      : uniq_entries * 5 / 4);
-    lookup.parms().block_begin = data.begin();
-    lookup.parms().hash .lang     = &lang;
-    lookup.parms().equal.cmp.lang = &lang;
+    WordTable lookup(uniq_entries, &lang, data.begin());
 
     Vector<Jump> jump1;
     Vector<Jump> jump2;
 
+    // (hash, offset) pairs for the deletion index
+    Vector<pair<u32int, u32int> > deletions;
+
+    // (hash, offset) pairs for the trigram index
+    Vector<pair<u32int, u32int> > trigrams;
+
+    Vector<ExpandedForm> forms;
+    ObjStack forms_sls;
+    ObjStack exp_buf;
+    String sl_buf;
+
+    Vector<u32int> filter;
+    u32int filter_blocks = 0;
+    if (lookup_filter) {
+      filter_blocks = (uniq_entries * filter_bits_per_word + 511) / 512;
+      if (filter_blocks == 0) filter_blocks = 1;
+      filter.resize(filter_blocks * filter_block_size);
+    }
+
     const int head_size = invisible_soundslike ? 3 : 2;
 
     const char * prev_sl = "";
@@ -1155,12 +2035,21 @@ namespace {
         prev_w_pos = data.size();
         data.write(p->word, p->word_size + 1);
         if (p->aff) data.write(p->aff, p->data_size - p->word_size - 1);
-        lookup.insert(pos);
+        u32int h = word_hash(&lang, p->word);
+        lookup.insert(pos, h);
+        if (lookup_filter)
+          filter_add(filter.data(), filter_blocks, filter_num_probes, h);
+        if (deletion_index) add_deletions(deletions, p->sl, pos);
+        if (trigram_index) add_trigrams(trigrams, p->sl, pos);
+        if (expanded_index) 
+          add_forms(forms, lang, p, pos, forms_sls, exp_buf, sl_buf);
 
         p = p->next;
 
       } else {
 
+        if (deletion_index) add_deletions(deletions, p->sl, data.size());
+        if (trigram_index) add_trigrams(trigrams, p->sl, data.size());
         data.write(p->sl, p->sl_size + 1);
 
         // write all word entries with the same soundslike
@@ -1174,7 +2063,10 @@ namespace {
           data[prev_w_pos - NEXT_O] = (byte)(pos - prev_w_pos);
           data.write(p->word, p->word_size + 1);
           if (p->aff) data.write(p->aff, p->data_size - p->word_size - 1);
-          lookup.insert(pos);
+          u32int h = word_hash(&lang, p->word);
+          lookup.insert(pos, h);
+          if (lookup_filter)
+            filter_add(filter.data(), filter_blocks, filter_num_probes, h);
 
           prev_w_pos = pos;
           prev_sl = p->sl;
@@ -1205,11 +2097,8 @@ namespace {
 
     memset(data.data(), 0, 8);
     
-    //CERR.printf("%d == %d\n", lookup.size(), uniq_entries);
-    //assert(lookup.size() == uniq_entries);
-
     data_head.word_count   = num_entries;
-    data_head.word_buckets = lookup.bucket_count();
+    data_head.word_buckets = lookup.buckets.size();
 
     FStream out;
     out.open(base, "wb");
@@ -1231,9 +2120,36 @@ namespace {
     out.write(data.data(), data.size());
 
     // Write hash
-    advance_file(out, round_up(out.tell(), DataHead::align));
+    advance_file(out, round_up(out.tell(), sizeof(WordBucket)));
     data_head.hash_offset = out.tell() - data_head.head_size;
-    out.write(&lookup.vector().front(), lookup.vector().size() * 4);
+    out.write(lookup.buckets.data(), lookup.buckets.size() * sizeof(WordBucket));
+    
+    // Write lookup filter
+    if (lookup_filter) {
+      advance_file(out, round_up(out.tell(), DataHead::align));
+      u32int filter_head[2] = {filter_blocks, filter_num_probes};
+      out.write(filter_head, 8);
+      advance_file(out, round_up(out.tell(), 64));
+      out.write(filter.data(), filter.size() * 4);
+    }
+
+    // Write deletion index
+    if (deletion_index) {
+      advance_file(out, round_up(out.tell(), DataHead::align));
+      write_deletion_index(out, deletions);
+    }
+
+    // Write trigram index
+    if (trigram_index) {
+      advance_file(out, round_up(out.tell(), DataHead::align));
+      write_trigram_index(out, trigrams);
+    }
+
+    // Write expanded form index
+    if (expanded_index) {
+      advance_file(out, round_up(out.tell(), DataHead::align));
+      RET_ON_ERR(write_expanded_index(out, forms));
+    }
     
     // calculate block size
     advance_file(out, round_up(out.tell(), DataHead::align));
@@ -51,16 +51,19 @@ namespace aspell { namespace sp {
 
   PosibErr<void> SpellerImpl::add_to_personal(MutableString word) {
     if (!personal_) return no_err;
+    clear_caches();
     return personal_->add(word);
   }
   
   PosibErr<void> SpellerImpl::add_to_session(MutableString word) {
     if (!session_) return no_err;
+    clear_caches();
     return session_->add(word);
   }
 
   PosibErr<void> SpellerImpl::clear_session() {
     if (!session_) return no_err;
+    clear_caches();
     return session_->clear();
   }
 
@@ -107,6 +110,7 @@ namespace aspell { namespace sp {
         return no_err;
       if (first_word == 0 || cor != first_word) {
         lang().to_lower(buf, mis.str());
+        sug_cache.clear();
         repl_->add_repl(buf, cor_orignal_casing);
       }
       
@@ -133,7 +137,23 @@ namespace aspell { namespace sp {
     return &suggest_->suggest(word);
   }
 
-  bool SpellerImpl::check_simple (ParmString w, WordEntry & w0) 
+  PosibErr<void> SpellerImpl::suggest_batch(const MutableString * words, 
+                                            unsigned num,
+                                            const WordList * * lists)
+  {
+    if (num == 0) return no_err;
+    Vector<const char *> w(num);
+    for (unsigned i = 0; i != num; ++i)
+      w[i] = words[i];
+    Vector<SuggestionList *> l(num);
+    suggest_->suggest(w.pbegin(), num, l.pbegin());
+    for (unsigned i = 0; i != num; ++i)
+      lists[i] = l[i];
+    return no_err;
+  }
+
+  bool SpellerImpl::check_simple (ParmString w, WordEntry & w0,
+                                  StatsCounts * stats) 
   {
     w0.clear(); // FIXME: is this necessary?
     const char * x = w;
@@ -142,37 +162,45 @@ namespace aspell { namespace sp {
     WS::const_iterator i   = check_ws.begin();
     WS::const_iterator end = check_ws.end();
     do {
+      if (stats) ++stats->probes;
       if ((*i)->lookup(w, &s_cmp, w0)) return true;
       ++i;
     } while (i != end);
     return false;
   };
 
-  bool SpellerImpl::check_affix(ParmString word, IntrCheckInfo & ci, GuessInfo * gi)
+  bool SpellerImpl::check_affix(ParmString word, IntrCheckInfo & ci, GuessInfo * gi,
+                                StatsCounts * stats)
   {
     WordEntry w;
-    bool res = check_simple(word, w);
+    bool res = check_simple(word, w, stats);
     if (res) {ci.word = w.word; return true;}
     if (affix_compress) {
-      res = lang_->affix()->affix_check(LookupInfo(this, LookupInfo::Word), word, ci, 0);
+      if (!affix_cache.lookup(word, ci, res)) {
+        res = lang_->affix()->affix_check(LookupInfo(this, LookupInfo::Word, stats), 
+                                          word, ci, 0);
+        affix_cache.insert(word, ci, res);
+      }
       if (res) return true;
     }
     if (affix_info && gi) {
-      lang_->affix()->affix_check(LookupInfo(this, LookupInfo::Guess), word, ci, gi);
+      lang_->affix()->affix_check(LookupInfo(this, LookupInfo::Guess, stats), 
+                                  word, ci, gi);
     }
     return false;
   }
 
   inline bool SpellerImpl::check2(char * word, /* it WILL modify word */
                                   bool try_uppercase,
-                                  IntrCheckInfo & ci, GuessInfo * gi)
+                                  IntrCheckInfo & ci, GuessInfo * gi,
+                                  StatsCounts * stats)
   {
-    bool res = check_affix(word, ci, gi);
+    bool res = check_affix(word, ci, gi, stats);
     if (res) return true;
     if (!try_uppercase) return false;
     char t = *word;
     *word = lang_->to_title(t);
-    res = check_affix(word, ci, gi);
+    res = check_affix(word, ci, gi, stats);
     *word = t;
     if (res) return true;
     return false;
@@ -182,12 +210,13 @@ namespace aspell { namespace sp {
                                     /* it WILL modify word */
                                     bool try_uppercase,
                                     unsigned run_together_limit,
-                                    IntrCheckInfo * ci, GuessInfo * gi)
+                                    IntrCheckInfo * ci, GuessInfo * gi,
+                                    StatsCounts * stats)
   {
     assert(run_together_limit <= 8); // otherwise it will go above the 
                                      // bounds of the word array
     ci->clear();
-    bool res = check2(word, try_uppercase, *ci, gi);
+    bool res = check2(word, try_uppercase, *ci, gi, stats);
     if (res) return true;
     if (run_together_limit <= 1) return false;
     enum {Yes, No, Unknown} is_title = try_uppercase ? Yes : Unknown;
@@ -198,12 +227,13 @@ namespace aspell { namespace sp {
       char t = *i;
       *i = '\0';
       //FIXME: clear ci, gi?
-      res = check2(word, try_uppercase, *ci, gi);
+      res = check2(word, try_uppercase, *ci, gi, stats);
       if (!res) {*i = t; continue;}
       if (is_title == Unknown)
         is_title = lang_->case_pattern(word) == FirstUpper ? Yes : No;
       *i = t;
-      if (check(i, word_end, is_title == Yes, run_together_limit - 1, ci + 1, 0)) {
+      if (check(i, word_end, is_title == Yes, run_together_limit - 1, ci + 1, 0,
+                stats)) {
         ci->compound = true;
         ci->next = ci + 1;
         return true;
@@ -212,6 +242,19 @@ namespace aspell { namespace sp {
     return false;
   }
 
+  PosibErr<bool> SpellerImpl::check_word(MutableString word,
+                                         IntrCheckInfo * ci, GuessInfo * gi)
+  {
+    unsigned limit = unconditional_run_together_ ? run_together_limit_ : 0;
+    if (!stats_enabled)
+      return check(word.begin(), word.end(), false, limit, ci, gi);
+    StatsCounts counts;
+    PosibErr<bool> res = check(word.begin(), word.end(), false, limit, ci, gi,
+                               &counts);
+    stats_totals.add_check(counts);
+    return res;
+  }
+
   //////////////////////////////////////////////////////////////////////
   //
   // Word list managment methods
@@ -220,8 +263,13 @@ namespace aspell { namespace sp {
   PosibErr<void> SpellerImpl::save_all_word_lists() {
     SpellerDict * i = dicts_;
     for (; i; i = i->next) {
-      if  (i->save_on_saveall)
-        RET_ON_ERR(i->dict->synchronize());
+      if  (!i->save_on_saveall) continue;
+      // saving merges in any words another process added to the
+      // file, and clears the list if that fails, so the caches can
+      // no longer be trusted either way
+      PosibErr<void> pe = i->dict->synchronize();
+      clear_caches();
+      if (pe.has_err()) return pe;
     }
     return no_err;
   }
@@ -387,6 +435,14 @@ namespace aspell { namespace sp {
       RET_ON_ERR(m->intr_suggest_->set_mode(mode));
       return no_err;
     }
+    static PosibErr<void> sug_cache_size(SpellerImpl * m, int value) {
+      m->sug_cache.set_max_size(value < 0 ? 0 : value);
+      return no_err;
+    }
+    static PosibErr<void> affix_cache_size(SpellerImpl * m, int value) {
+      m->affix_cache.set_max_size(value < 0 ? 0 : value);
+      return no_err;
+    }
     static PosibErr<void> run_together(SpellerImpl * m, bool value) {
       m->unconditional_run_together_ = value;
       m->run_together = m->unconditional_run_together_;
@@ -405,6 +461,11 @@ namespace aspell { namespace sp {
       m->run_together_min_ = value;
       return no_err;
     }
+    static PosibErr<void> stats(SpellerImpl * m, bool value) {
+      m->stats_enabled = value;
+      m->count_conv_bytes(m->to_internal_, m->from_internal_);
+      return no_err;
+    }
     
   };
 
@@ -416,6 +477,8 @@ namespace aspell { namespace sp {
     ,{"ignore-repl",   UpdateMember::Bool,    UpdateMember::CN::ignore_repl}
     //,{"save-repl",     UpdateMember::Bool,    UpdateMember::CN::save_repl}
     ,{"sug-mode",      UpdateMember::String,  UpdateMember::CN::sug_mode}
+    ,{"sug-cache-size",UpdateMember::Int,     UpdateMember::CN::sug_cache_size}
+    ,{"affix-cache-size",UpdateMember::Int,   UpdateMember::CN::affix_cache_size}
     ,{"run-together",  
         UpdateMember::Bool,    
         UpdateMember::CN::run_together}
@@ -425,6 +488,7 @@ namespace aspell { namespace sp {
     ,{"run-together-min",  
         UpdateMember::Int,    
         UpdateMember::CN::run_together_min}
+    ,{"collect-stats", UpdateMember::Bool,    UpdateMember::CN::stats}
   };
 
   template <typename T>
@@ -439,6 +503,9 @@ namespace aspell { namespace sp {
       if (strcmp(ki->name, i->name) == 0) {
         if (i->type == t) {
           RET_ON_ERR(i->fun.call(m, value));
+          // most of these can change what is suggested, and some
+          // what is found by affix stripping
+          m->clear_caches();
           break;
         }
       }
@@ -454,7 +521,8 @@ namespace aspell { namespace sp {
 
   SpellerImpl::SpellerImpl() 
     : Speller(0) /* FIXME */, ignore_repl(true), 
-      dicts_(0), personal_(0), session_(0), repl_(0), main_(0)
+      dicts_(0), personal_(0), session_(0), repl_(0), main_(0),
+      stats_enabled(false)
   {}
 
   static inline PosibErr<void> add_dicts(SpellerImpl * sp, DictList & d)
@@ -474,6 +542,7 @@ namespace aspell { namespace sp {
 
     ignore_repl = config_->retrieve_bool("ignore-repl");
     ignore_count = config_->retrieve_int("ignore");
+    stats_enabled = config_->retrieve_bool("collect-stats");
 
     DictList to_add;
     RET_ON_ERR(add_data_set(config_->retrieve("master-path"), *config_, &to_add, this));
@@ -608,10 +677,17 @@ namespace aspell { namespace sp {
     soundslike_root_only = suggest_ws.front()->soundslike_root_only;
     affix_compress = !affix_ws.empty();
 
+    int affix_cache_size = config_->retrieve_int("affix-cache-size");
+    affix_cache.set_max_size(affix_cache_size < 0 ? 0 : affix_cache_size);
+    affix_cache.clear();
+
     //
     // Setup suggest
     //
 
+    int sug_cache_size = config_->retrieve_int("sug-cache-size");
+    sug_cache.set_max_size(sug_cache_size < 0 ? 0 : sug_cache_size);
+
     PosibErr<Suggest *> pe;
     pe = new_default_suggest(this);
     if (pe.has_err()) return pe;
@@ -623,22 +699,31 @@ namespace aspell { namespace sp {
     return no_err;
   }
 
-  PosibErr<void> SpellerImpl::reload_conv()
+  static PosibErr<void> new_conv(const Config & config, const LangImpl & lang,
+                                 ClonePtr<FullConvert> & to_internal,
+                                 ClonePtr<FullConvert> & from_internal)
   {
-    const char * sys_enc = lang_->charmap();
-    String user_enc = config_->retrieve("encoding");
+    const char * sys_enc = lang.charmap();
+    String user_enc = config.retrieve("encoding");
     if (user_enc == "none") {
       //config_->replace("encoding", sys_enc);
       user_enc = sys_enc;
     }
 
     PosibErr<FullConvert *> conv;
-    conv = new_full_convert(*config_, user_enc, sys_enc, NormFrom);
+    conv = new_full_convert(config, user_enc, sys_enc, NormFrom);
     if (conv.has_err()) return conv;
-    to_internal_.reset(conv);
-    conv = new_full_convert(*config_, sys_enc, user_enc, NormTo);
+    to_internal.reset(conv);
+    conv = new_full_convert(config, sys_enc, user_enc, NormTo);
     if (conv.has_err()) return conv;
-    from_internal_.reset(conv);
+    from_internal.reset(conv);
+    return no_err;
+  }
+
+  PosibErr<void> SpellerImpl::reload_conv()
+  {
+    RET_ON_ERR(new_conv(*config_, *lang_, to_internal_, from_internal_));
+    count_conv_bytes(to_internal_, from_internal_);
 
     String tmp;
     get_base_enc(tmp, to_internal_->in_code());
@@ -651,6 +736,55 @@ namespace aspell { namespace sp {
     return no_err;
   }
 
+  void SpellerImpl::count_conv_bytes(FullConvert * to_internal,
+                                     FullConvert * from_internal)
+  {
+    to_internal->count_bytes(stats_enabled ? &stats_totals.bytes_to_internal : 0);
+    from_internal->count_bytes(stats_enabled ? &stats_totals.bytes_from_internal : 0);
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  //
+  // SpellerContext
+  //
+
+  class SpellerContextImpl : public SpellerContext
+  {
+  public:
+    SpellerImpl *     sp;
+    ClonePtr<Suggest> suggest_;
+    IntrCheckInfo     check_inf[8];
+    GuessInfo         guess_info;
+
+    PosibErr<bool> check(MutableString word) {
+      guess_info.reset();
+      return sp->check_word(word, check_inf, &guess_info);
+    }
+
+    const IntrCheckInfo * intr_check_info() {
+      if (check_inf[0].word)
+        return check_inf;
+      else if (guess_info.head)
+        return guess_info.head;
+      else
+        return 0;
+    }
+
+    PosibErr<const WordList *> suggest(MutableString word) {
+      return &suggest_->suggest(word);
+    }
+  };
+
+  PosibErr<SpellerContext *> SpellerImpl::new_context()
+  {
+    LOCK(&context_lock_);
+    StackPtr<SpellerContextImpl> c(new SpellerContextImpl);
+    c->sp = this;
+    RET_ON_ERR(new_conv(*config_, *lang_, c->to_internal_, c->from_internal_));
+    count_conv_bytes(c->to_internal_, c->from_internal_);
+    c->suggest_.reset(suggest_->clone());
+    return c.release();
+  }
 
   //////////////////////////////////////////////////////////////////////
   //
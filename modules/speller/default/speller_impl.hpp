@@ -10,6 +10,9 @@
 #include "enumeration.hpp"
 #include "speller.hpp"
 #include "check_list.hpp"
+#include "lock.hpp"
+#include "suggest.hpp"
+#include "stats.hpp"
 
 namespace aspell {
   class StringMap;
@@ -19,6 +22,8 @@ namespace aspell {
 // The speller class is responsible for keeping track of the
 // dictionaries coming up with suggestions and the like. Its methods
 // are NOT meant to be used my multiple threads and/or documents.
+// To share a speller between threads give each thread its own
+// context, see new_context().
 
 namespace aspell { namespace sp {
 
@@ -91,16 +96,21 @@ namespace aspell { namespace sp {
     // Spelling methods
     //
   
+    // if stats is set the dictionary lookups are counted in it
     PosibErr<bool> check(char * word, char * word_end, /* it WILL modify word */
                          bool try_uppercase,
 			 unsigned run_together_limit,
-			 IntrCheckInfo *, GuessInfo *);
+			 IntrCheckInfo *, GuessInfo *,
+                         StatsCounts * stats = 0);
+
+    // checks a word as given to check(MutableString), and counts it
+    // if the "collect-stats" option is set
+    PosibErr<bool> check_word(MutableString word, 
+                              IntrCheckInfo *, GuessInfo *);
 
     PosibErr<bool> check(MutableString word) {
       guess_info.reset();
-      return check(word.begin(), word.end(), false,
-		   unconditional_run_together_ ? run_together_limit_ : 0,
-		   check_inf, &guess_info);
+      return check_word(word, check_inf, &guess_info);
     }
     PosibErr<bool> check(ParmString word)
     {
@@ -113,11 +123,12 @@ namespace aspell { namespace sp {
 
     bool check2(char * word, /* it WILL modify word */
                 bool try_uppercase,
-                IntrCheckInfo & ci, GuessInfo * gi);
+                IntrCheckInfo & ci, GuessInfo * gi, StatsCounts * stats);
 
-    bool check_affix(ParmString word, IntrCheckInfo & ci, GuessInfo * gi);
+    bool check_affix(ParmString word, IntrCheckInfo & ci, GuessInfo * gi,
+                     StatsCounts * stats = 0);
 
-    bool check_simple(ParmString, WordEntry &);
+    bool check_simple(ParmString, WordEntry &, StatsCounts * stats = 0);
 
     const IntrCheckInfo * intr_check_info() {
       if (check_inf[0].word)
@@ -143,12 +154,29 @@ namespace aspell { namespace sp {
     // the suggestion list and the elements in it are only 
     // valid until the next call to suggest.
 
+    PosibErr<void> suggest_batch(const MutableString * words, unsigned num,
+                                 const WordList * * lists);
+
+    unsigned int suggest_cache_hits() const {return sug_cache.hits();}
+    unsigned int suggest_cache_misses() const {return sug_cache.misses();}
+
+    unsigned int affix_cache_hits() const {return affix_cache.hits();}
+    unsigned int affix_cache_misses() const {return affix_cache.misses();}
+
+    const SpellerStats * stats() {
+      stats_totals.get(stats_buf_);
+      return &stats_buf_;
+    }
+    void reset_stats() {stats_totals.reset();}
+
     PosibErr<void> store_replacement(MutableString mis, 
 				     MutableString cor);
 
     PosibErr<void> store_replacement(const String & mis, const String & cor,
 				     bool memory);
 
+    PosibErr<SpellerContext *> new_context();
+
     //
     // Private Stuff (from here to the end of the class)
     //
@@ -168,6 +196,8 @@ namespace aspell { namespace sp {
     bool                    ignore_repl;
     String                  prev_mis_repl_;
     String                  prev_cor_repl_;
+    Mutex                   context_lock_; // held while creating a context
+    SpellerStats            stats_buf_;
 
     void operator= (const SpellerImpl &other);
     SpellerImpl(const SpellerImpl &other);
@@ -219,6 +249,24 @@ namespace aspell { namespace sp {
 
     bool run_together;
 
+    // shared by suggest_ and intr_suggest_, cleared whenever the
+    // personal, session or replacement word lists change
+    SuggestCache sug_cache;
+
+    // the results of affix stripping, see check_affix; cleared along
+    // with sug_cache
+    AffixCache affix_cache;
+
+    void clear_caches() {sug_cache.clear(); affix_cache.clear();}
+
+    bool        stats_enabled; // the "collect-stats" option
+    StatsTotals stats_totals;
+
+    // makes the converters count the bytes they write if the
+    // "collect-stats" option is set, or stop counting if it is not
+    void count_conv_bytes(FullConvert * to_internal, 
+                          FullConvert * from_internal);
+
   };
 
   struct LookupInfo {
@@ -226,7 +274,8 @@ namespace aspell { namespace sp {
     enum Mode {Word, Guess, Clean, Soundslike, AlwaysTrue} mode;
     SpellerImpl::WS::const_iterator begin;
     SpellerImpl::WS::const_iterator end;
-    inline LookupInfo(SpellerImpl * s, Mode m);
+    StatsCounts * stats; // if set lookups and candidates are counted in it
+    inline LookupInfo(SpellerImpl * s, Mode m, StatsCounts * st = 0);
     // returns 0 if nothing found
     // 1 if a match is found
     // -1 if a word is found but affix doesn't match and "gi"
@@ -234,8 +283,8 @@ namespace aspell { namespace sp {
                 WordEntry & o, GuessInfo * gi) const;
   };
 
-  inline LookupInfo::LookupInfo(SpellerImpl * s, Mode m) 
-    : sp(s), mode(m) 
+  inline LookupInfo::LookupInfo(SpellerImpl * s, Mode m, StatsCounts * st) 
+    : sp(s), mode(m), stats(st) 
   {
     switch (m) { 
     case Word: 
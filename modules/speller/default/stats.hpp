@@ -0,0 +1,112 @@
+// This file is part of The New Aspell
+// Copyright (C) 2011 by Kevin Atkinson under the GNU LGPL license
+// version 2.0 or 2.1.  You should have received a copy of the LGPL
+// license along with this library if you did not you can find
+// it at http://www.gnu.org/.
+
+#ifndef ASPELLER_STATS__HPP
+#define ASPELLER_STATS__HPP
+
+#include <string.h>
+#include <time.h>
+
+#include "settings.h"
+
+#include "atomic.hpp"
+#include "lock.hpp"
+#include "speller_stats.hpp"
+
+// The counters behind the "collect-stats" option.  While a word is
+// checked, or suggestions are found for it, the counts are kept in a
+// StatsCounts owned by the thread doing the work.  They are then
+// added to the speller's StatsTotals all at once so that threads
+// sharing a speller do not fight over the counters.
+
+namespace aspell { namespace sp {
+
+  struct StatsCounts {
+    unsigned long probes;
+    unsigned long affix_candidates;
+    unsigned long stage_calls[StageCount];
+    double        stage_time[StageCount];
+    StatsCounts() {memset(this, 0, sizeof(StatsCounts));}
+  };
+
+  // returns the time in seconds from some fixed point
+  static inline double stats_now()
+  {
+#ifdef HAVE_CLOCK_GETTIME
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+#else
+    return clock()/(double)CLOCKS_PER_SEC;
+#endif
+  }
+
+  // Times a stage of finding suggestions from construction to
+  // destruction, does nothing if counts is null.
+  class StageTimer {
+    StatsCounts * counts;
+    SuggestStage stage;
+    double start;
+  public:
+    StageTimer(StatsCounts * c, SuggestStage s)
+      : counts(c), stage(s), start(c ? stats_now() : 0) {}
+    ~StageTimer() {
+      if (!counts) return;
+      counts->stage_calls[stage]++;
+      counts->stage_time[stage] += stats_now() - start;
+    }
+  };
+
+  class StatsTotals {
+    volatile unsigned long checks_;
+    volatile unsigned long check_probes_;
+    volatile unsigned long check_affix_candidates_;
+    Mutex lock_; // protects suggest_
+    SpellerStats suggest_;
+  public:
+    volatile unsigned long bytes_to_internal;
+    volatile unsigned long bytes_from_internal;
+    StatsTotals() {reset();}
+    void add_check(const StatsCounts & c) {
+      atomic_add(checks_, 1);
+      atomic_add(check_probes_, c.probes);
+      atomic_add(check_affix_candidates_, c.affix_candidates);
+    }
+    void add_suggest(const StatsCounts & c) {
+      LOCK(&lock_);
+      suggest_.suggests++;
+      suggest_.suggest_probes   += c.probes;
+      suggest_.affix_candidates += c.affix_candidates;
+      for (int i = 0; i != StageCount; ++i) {
+        suggest_.stage_calls[i] += c.stage_calls[i];
+        suggest_.stage_time[i]  += c.stage_time[i];
+      }
+    }
+    void get(SpellerStats & s) {
+      {
+        LOCK(&lock_);
+        s = suggest_;
+      }
+      s.checks              = atomic_load(checks_);
+      s.check_probes        = atomic_load(check_probes_);
+      s.affix_candidates   += atomic_load(check_affix_candidates_);
+      s.bytes_to_internal   = atomic_load(bytes_to_internal);
+      s.bytes_from_internal = atomic_load(bytes_from_internal);
+    }
+    void reset() {
+      LOCK(&lock_);
+      memset(&suggest_, 0, sizeof(SpellerStats));
+      atomic_store(checks_, 0);
+      atomic_store(check_probes_, 0);
+      atomic_store(check_affix_candidates_, 0);
+      atomic_store(bytes_to_internal, 0);
+      atomic_store(bytes_from_internal, 0);
+    }
+  };
+
+} }
+
+#endif
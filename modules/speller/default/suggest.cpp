@@ -102,6 +102,7 @@
 #include "hash-t.hpp"
 #include "lang_impl.hpp"
 #include "leditdist.hpp"
+#include "parallel.hpp"
 #include "speller_impl.hpp"
 #include "stack_ptr.hpp"
 #include "suggest.hpp"
@@ -231,12 +232,15 @@ namespace {
   };
 
   class Working : public Score {
+
+    class ScanPart;
+    typedef void (Working::* ScanFun)(SpellerImpl::WS::const_iterator, 
+                                      SoundslikeEnumeration *, int &);
    
     int threshold;
     int try_harder;
 
-    EditDist (* edit_dist_fun)(const char *, const char *,
-                               const EditDistanceWeights &);
+    int scan_limit; // the edit distance limit for try_scan_*, 1 or 2
 
     unsigned int max_word_length;
 
@@ -255,6 +259,18 @@ namespace {
 
     IntrCheckInfo check_info[8];
 
+    // null unless the "collect-stats" option is set
+    StatsCounts * stats;
+    StatsCounts   stats_counts;
+
+    // used by scan_root
+    const char * const * root_sls_begin;
+    const char * const * root_sls_end;
+
+    // the near misses from the parts of a parallel scan point into
+    // the part's buffer so the parts need to stay around
+    Vector<ScanPart *> scan_parts;
+
     void commit_temp(const char * b) {
       if (temp_end) {
         buffer.resize_temp(temp_end - b + 1);
@@ -265,12 +281,12 @@ namespace {
       temp_end = 0;}
     const char * to_soundslike_temp(const char * w, unsigned s, unsigned * len = 0) {
       char * sl = (char *)buffer.alloc_temp(s + 1);
-      temp_end = lang->LangImpl::to_soundslike(sl, w, s);
+      temp_end = lang->LangImpl::to_soundslike_cached(sl, w, s);
       if (len) *len = temp_end - sl;
       return sl;}
     const char * to_soundslike_temp(const WordEntry & sw) {
       char * sl = (char *)buffer.alloc_temp(sw.word_size + 1);
-      temp_end = lang->LangImpl::to_soundslike(sl, sw.word, sw.word_size, sw.word_info);
+      temp_end = lang->LangImpl::to_soundslike_cached(sl, sw.word, sw.word_size, sw.word_info);
       if (temp_end == 0) return sw.word;
       else return sl;}
     const char * to_soundslike(const char * w, unsigned s) {
@@ -279,6 +295,7 @@ namespace {
       commit_temp(sl);
       return sl;}
 
+    bool check(ParmString word);
     MutableString form_word(IntrCheckInfo & ci);
     void try_word_n(ParmString str, int score);
     bool check_word_s(ParmString word, IntrCheckInfo * ci);
@@ -344,6 +361,16 @@ namespace {
     void try_repl();
     void try_ngram();
 
+    void scan(ScanFun);
+    bool scan_parallel(ScanFun, SpellerImpl::WS::const_iterator, bool expanded,
+                       int & stopped_at);
+    template <class EditDistFun>
+    void scan_dict(SpellerImpl::WS::const_iterator, SoundslikeEnumeration *,
+                   int & stopped_at);
+    template <class EditDistFun>
+    void scan_dict_root(SpellerImpl::WS::const_iterator, SoundslikeEnumeration *,
+                        int & stopped_at);
+
     void merge_dups();
  
     void score_list(bool score_all);
@@ -360,12 +387,42 @@ namespace {
   public:
     Working(SpellerImpl * m, const LangImpl *l,
 	    const String & w, const SuggestParms *  p)
-      : Score(l,w,p), threshold(1), max_word_length(0), sp(m) {
+      : Score(l,w,p), threshold(1), max_word_length(0), sp(m),
+        stats(m->stats_enabled ? &stats_counts : 0),
+        root_sls_begin(0), root_sls_end(0) {
       memset(check_info, 0, sizeof(check_info));
     }
+    ~Working();
     void get_suggestions(NearMissesFinal &sug);
   };
 
+  // A part of a dictionary scanned in its own thread.  Each part uses
+  // its own Working object so that there is no shared mutable state.
+  class Working::ScanPart : public ParallelJob {
+  public:
+    Working work;
+    ScanFun fun;
+    SpellerImpl::WS::const_iterator dict;
+    StackPtr<SoundslikeEnumeration> els;
+    int stopped_at;
+    ScanPart(const Working & parent, ScanFun f, 
+             SpellerImpl::WS::const_iterator i, SoundslikeEnumeration * e,
+             int s)
+      : work(parent.sp, parent.lang, parent.original.word, parent.parms),
+        fun(f), dict(i), els(e), stopped_at(s) 
+    {
+      work.root_sls_begin = parent.root_sls_begin;
+      work.root_sls_end   = parent.root_sls_end;
+    }
+    void run() {(work.*fun)(dict, els, stopped_at);}
+  };
+
+  Working::~Working() {
+    for (Vector<ScanPart *>::iterator i = scan_parts.begin(); 
+         i != scan_parts.end(); ++i)
+      delete *i;
+  }
+
   void Working::get_suggestions(NearMissesFinal & sug) {
 
     if (original.word.size() * parms->edit_distance_weights.max >= 0x8000)
@@ -408,7 +465,7 @@ namespace {
 #ifdef DEBUG_SUGGEST
       COUT.printl("TRYING SCAN 1");
 #endif
-      edit_dist_fun = limit1_edit_distance;
+      scan_limit = 1;
 
       if (sp->soundslike_root_only)
         try_scan_root();
@@ -427,7 +484,7 @@ namespace {
       COUT.printl("TRYING SCAN 2");
 #endif
 
-      edit_dist_fun = limit2_edit_distance;
+      scan_limit = 2;
 
       if (sp->soundslike_root_only)
         try_scan_root();
@@ -457,6 +514,21 @@ namespace {
     fine_tune_score();
 
     transfer();
+
+    if (stats) sp->stats_totals.add_suggest(*stats);
+  }
+
+  // Same as sp->check but it does not use any state in sp, so that
+  // several words can be worked on at once.
+  bool Working::check(ParmString str)
+  {
+    VARARRAY(char, word, str.size() + 1);
+    memcpy(word, str, str.size());
+    word[str.size()] = '\0';
+    IntrCheckInfo ci[8];
+    return sp->check(word, word + str.size(), false,
+                     sp->unconditional_run_together_ ? sp->run_together_limit_ : 0,
+                     ci, 0, stats);
   }
 
   // Forms a word by combining IntrCheckInfo fields.
@@ -485,13 +557,14 @@ namespace {
          i != sp->suggest_ws.end();
          ++i)
     {
+      if (stats) ++stats->probes;
       (*i)->clean_lookup(str, sw);
       for (;!sw.at_end(); sw.adv())
         add_nearmiss(i, sw, 0, score, -1, do_count);
     }
     if (sp->affix_compress) {
       IntrCheckInfo ci; memset(&ci, 0, sizeof(ci));
-      bool res = lang->affix()->affix_check(LookupInfo(sp, LookupInfo::Clean), str, ci, 0);
+      bool res = lang->affix()->affix_check(LookupInfo(sp, LookupInfo::Clean, stats), str, ci, 0);
       if (!res) return;
       form_word(ci);
       char * end = (char *)buffer.grow_temp(1);
@@ -509,6 +582,7 @@ namespace {
          i != sp->suggest_ws.end();
          ++i)
     {
+      if (stats) ++stats->probes;
       (*i)->clean_lookup(word, sw);
       if (!sw.at_end()) {
         ci->word = sw.word;
@@ -516,7 +590,7 @@ namespace {
       }
     }
     if (sp->affix_compress) {
-      return lang->affix()->affix_check(LookupInfo(sp, LookupInfo::Clean), word, *ci, 0);
+      return lang->affix()->affix_check(LookupInfo(sp, LookupInfo::Clean, stats), word, *ci, 0);
     }
     return false;
   }
@@ -638,6 +712,7 @@ namespace {
   }
 
   void Working::try_split() {
+    StageTimer timer(stats, StageSplit);
     const String & word       = original.word;
     
     if (word.size() < 4 || parms->split_chars.empty()) return;
@@ -655,7 +730,7 @@ namespace {
       new_word[i+1] = new_word[i];
       new_word[i] = '\0';
       
-      if (sp->check(new_word) && sp->check(new_word + i + 1)) {
+      if (check(new_word) && check(new_word + i + 1)) {
         for (size_t j = 0; j != parms->split_chars.size(); ++j)
         {
           new_word[i] = parms->split_chars[j];
@@ -669,6 +744,7 @@ namespace {
 
   void Working::try_one_edit_word() 
   {
+    StageTimer timer(stats, StageOneEditWord);
     const String & orig = original.clean;
     const char * replace_list = lang->clean_chars();
     char a,b;
@@ -765,114 +841,17 @@ namespace {
 
   void Working::try_scan() 
   {
-    const char * original_soundslike = original.soundslike.str();
-    
-    WordEntry * sw;
-    WordEntry w;
-    const char * sl = 0;
-    EditDist score;
-    unsigned int stopped_at = LARGE_NUM;
-    WordAff * exp_list;
-    WordAff single;
-    single.next = 0;
-
-    for (SpellerImpl::WS::const_iterator i = sp->suggest_ws.begin();
-         i != sp->suggest_ws.end();
-         ++i) 
-    {
-      //CERR.printf(">>%p %s\n", *i, typeid(**i).name());
-      StackPtr<SoundslikeEnumeration> els((*i)->soundslike_elements());
-
-      while ( (sw = els->next(stopped_at)) ) {
-
-        //CERR.printf("[%s (%d) %d]\n", sw->word, sw->word_size, sw->what);
-        //assert(strlen(sw->word) == sw->word_size);
-          
-        if (sw->what != WordEntry::Word) {
-          sl = sw->word;
-          abort_temp();
-        } else if (!*sw->aff) {
-          sl = to_soundslike_temp(*sw);
-        } else {
-          goto affix_case;
-        }
-
-        //CERR.printf("SL = %s\n", sl);
-        
-        score = edit_dist_fun(sl, original_soundslike, parms->edit_distance_weights);
-        stopped_at = score.stopped_at - sl;
-        if (score >= LARGE_NUM) continue;
-        stopped_at = LARGE_NUM;
-        commit_temp(sl);
-        add_sound(i, sw, sl, score);
-        continue;
-        
-      affix_case:
-        
-        temp_buffer.reset();
-        
-        // first expand any prefixes
-        if (sp->fast_scan) { // if fast_scan than no prefixes
-          single.word.str = sw->word;
-          single.word.size = strlen(sw->word);
-          single.aff = (const unsigned char *)sw->aff;
-          exp_list = &single;
-        } else {
-          exp_list = lang->affix()->expand_prefix(sw->word, sw->aff, temp_buffer);
-        }
-        
-        // iterate through each semi-expanded word, any affix flags
-        // are now guaranteed to be suffixes
-        for (WordAff * p = exp_list; p; p = p->next)
-        {
-          // try the root word
-          unsigned sl_len;
-          sl = to_soundslike_temp(p->word.str, p->word.size, &sl_len);
-          score = edit_dist_fun(sl, original_soundslike, parms->edit_distance_weights);
-          stopped_at = score.stopped_at - sl;
-          stopped_at += p->word.size - sl_len;
-          
-          if (score < LARGE_NUM) {
-            commit_temp(sl);
-            add_nearmiss(i, p, sl, -1, score, do_count);
-          }
-          
-          // expand any suffixes, using stopped_at as a hint to avoid
-          // unneeded expansions.  Note stopped_at is the last character
-          // looked at by limit_edit_dist.  Thus if the character
-          // at stopped_at is changed it might effect the result
-          // hence the "limit" is stopped_at + 1
-          if (p->word.size - lang->affix()->max_strip() > stopped_at)
-            exp_list = 0;
-          else
-            exp_list = lang->affix()->expand_suffix(p->word, p->aff, 
-                                                    temp_buffer, 
-                                                    stopped_at + 1);
-          
-          // reset stopped_at if necessary
-          if (score < LARGE_NUM) stopped_at = LARGE_NUM;
-          
-          // iterate through fully expanded words, if any
-          for (WordAff * q = exp_list; q; q = q->next) {
-            sl = to_soundslike_temp(q->word.str, q->word.size);
-            score = edit_dist_fun(sl, original_soundslike, parms->edit_distance_weights);
-            if (score >= LARGE_NUM) continue;
-            commit_temp(sl);
-            add_nearmiss(i, q, sl, -1, score, do_count);
-          }
-        }
-      }
-    }
+    StageTimer timer(stats, scan_limit == 1 ? StageScan1 : StageScan2);
+    if (scan_limit == 1)
+      scan(&Working::scan_dict<Limit1EditDist>);
+    else
+      scan(&Working::scan_dict<Limit2EditDist>);
   }
 
   void Working::try_scan_root() 
   {
-
-    WordEntry * sw;
-    WordEntry w;
+    StageTimer timer(stats, scan_limit == 1 ? StageScan1 : StageScan2);
     const char * sl = 0;
-    EditDist score;
-    int stopped_at = LARGE_NUM;
     GuessInfo gi;
     lang->munch(original.word, &gi);
     Vector<const char *> sls;
@@ -894,38 +873,223 @@ namespace {
 #endif
       }
     }
-    const char * * begin = sls.pbegin();
-    const char * * end   = sls.pend();
+    root_sls_begin = sls.pbegin();
+    root_sls_end   = sls.pend();
+    if (scan_limit == 1)
+      scan(&Working::scan_dict_root<Limit1EditDist>);
+    else
+      scan(&Working::scan_dict_root<Limit2EditDist>);
+    root_sls_begin = root_sls_end = 0;
+  }
+
+  void Working::scan(ScanFun fun)
+  {
+    int stopped_at = LARGE_NUM;
     for (SpellerImpl::WS::const_iterator i = sp->suggest_ws.begin();
          i != sp->suggest_ws.end();
          ++i) 
     {
+      if (scan_limit == 1 && !root_sls_begin) {
+        // when the dictionary has a deletion index only the entries
+        // which may be within one edit need to be looked at
+        StackPtr<SoundslikeEnumeration> 
+          els((*i)->soundslike_neighbors(original.soundslike));
+        if (els) {
+          (this->*fun)(i, els, stopped_at);
+          continue;
+        }
+      }
+      if (!root_sls_begin && sp->fast_scan) {
+        // an expanded form index already has the forms made by adding
+        // suffixes along with their soundslike, which is everything
+        // scan_dict would make as prefixes are skipped when fast_scan
+        // is set
+        StackPtr<SoundslikeEnumeration> els((*i)->expanded_elements(0, 1));
+        if (els) {
+          if (parms->scan_threads == 1 || !scan_parallel(fun, i, true, stopped_at))
+            (this->*fun)(i, els, stopped_at);
+          continue;
+        }
+      }
+      if (parms->scan_threads != 1 && scan_parallel(fun, i, false, stopped_at))
+        continue;
+      //CERR.printf(">>%p %s\n", *i, typeid(**i).name());
       StackPtr<SoundslikeEnumeration> els((*i)->soundslike_elements());
+      (this->*fun)(i, els, stopped_at);
+    }
+  }
+
+  // Scans the dictionary in several parts at once.  Returns false if
+  // the dictionary can not be split.  The near misses of each part
+  // are merged in order so that the final list is exactly the same
+  // as if the dictionary was scanned in one go.
+  bool Working::scan_parallel(ScanFun fun, SpellerImpl::WS::const_iterator i,
+                              bool expanded, int & stopped_at)
+  {
+    unsigned num_threads = parms->scan_threads;
+    if (num_threads == 0) num_threads = num_processors();
+    if (num_threads <= 1) return false;
+    // use more parts than threads since the amount of work in each
+    // part can vary widely
+    unsigned num = num_threads * 4;
+    Vector<ParallelJob *> jobs;
+    unsigned first = scan_parts.size();
+    for (unsigned p = 0; p != num; ++p) {
+      SoundslikeEnumeration * els = expanded 
+        ? (*i)->expanded_elements(p, num) 
+        : (*i)->soundslike_elements(p, num);
+      if (!els) break;
+      scan_parts.push_back(new ScanPart(*this, fun, i, els, 
+                                        p == 0 ? stopped_at : LARGE_NUM));
+      jobs.push_back(scan_parts.back());
+    }
+    if (jobs.empty()) return false;
+    assert(jobs.size() == num);
+    run_parallel(jobs.pbegin(), jobs.size(), num_threads);
+    for (Vector<ScanPart *>::iterator j = scan_parts.begin() + first;
+         j != scan_parts.end(); ++j)
+    {
+      Working & w = (*j)->work;
+      near_misses.splice_front(w.near_misses);
+      if (w.max_word_length > max_word_length) 
+        max_word_length = w.max_word_length;
+      stopped_at = (*j)->stopped_at;
+    }
+    return true;
+  }
+
+  template <class EditDistFun>
+  void Working::scan_dict(SpellerImpl::WS::const_iterator i,
+                          SoundslikeEnumeration * els, 
+                          int & stopped_at0)
+  {
+    EditDistFun edit_dist_fun;
+    const char * original_soundslike = original.soundslike.str();
+    
+    WordEntry * sw;
+    WordEntry w;
+    const char * sl = 0;
+    EditDist score;
+    unsigned int stopped_at = stopped_at0;
+    WordAff * exp_list;
+    WordAff single;
+    single.next = 0;
 
-      while ( (sw = els->next(stopped_at)) ) {
+    while ( (sw = els->next(stopped_at)) ) {
+
+      //CERR.printf("[%s (%d) %d]\n", sw->word, sw->word_size, sw->what);
+      //assert(strlen(sw->word) == sw->word_size);
           
-        if (sw->what != WordEntry::Word) {
-          sl = sw->word;
-          abort_temp();
-        } else {
-          sl = to_soundslike_temp(*sw);
-        } 
+      if (sw->what != WordEntry::Word) {
+        sl = sw->word;
+        abort_temp();
+      } else if (!*sw->aff) {
+        sl = to_soundslike_temp(*sw);
+      } else {
+        goto affix_case;
+      }
 
-        stopped_at = LARGE_NUM;
-        for (const char * * s = begin; s != end; ++s) {
-          score = edit_dist_fun(sl, *s, 
-                                parms->edit_distance_weights);
-          if (score.stopped_at - sl < stopped_at)
-            stopped_at = score.stopped_at - sl;
+      //CERR.printf("SL = %s\n", sl);
+        
+      score = edit_dist_fun(sl, original_soundslike, parms->edit_distance_weights);
+      stopped_at = score.stopped_at - sl;
+      if (score >= LARGE_NUM) continue;
+      stopped_at = LARGE_NUM;
+      commit_temp(sl);
+      add_sound(i, sw, sl, score);
+      continue;
+        
+    affix_case:
+        
+      temp_buffer.reset();
+        
+      // first expand any prefixes
+      if (sp->fast_scan) { // if fast_scan than no prefixes
+        single.word.str = sw->word;
+        single.word.size = strlen(sw->word);
+        single.aff = (const unsigned char *)sw->aff;
+        exp_list = &single;
+      } else {
+        exp_list = lang->affix()->expand_prefix(sw->word, sw->aff, temp_buffer);
+      }
+        
+      // iterate through each semi-expanded word, any affix flags
+      // are now guaranteed to be suffixes
+      for (WordAff * p = exp_list; p; p = p->next)
+      {
+        // try the root word
+        unsigned sl_len;
+        sl = to_soundslike_temp(p->word.str, p->word.size, &sl_len);
+        score = edit_dist_fun(sl, original_soundslike, parms->edit_distance_weights);
+        stopped_at = score.stopped_at - sl;
+        stopped_at += p->word.size - sl_len;
+          
+        if (score < LARGE_NUM) {
+          commit_temp(sl);
+          add_nearmiss(i, p, sl, -1, score, do_count);
+        }
+          
+        // expand any suffixes, using stopped_at as a hint to avoid
+        // unneeded expansions.  Note stopped_at is the last character
+        // looked at by limit_edit_dist.  Thus if the character
+        // at stopped_at is changed it might effect the result
+        // hence the "limit" is stopped_at + 1
+        if (p->word.size - lang->affix()->max_strip() > stopped_at)
+          exp_list = 0;
+        else
+          exp_list = lang->affix()->expand_suffix(p->word, p->aff, 
+                                                  temp_buffer, 
+                                                  stopped_at + 1);
+          
+        // reset stopped_at if necessary
+        if (score < LARGE_NUM) stopped_at = LARGE_NUM;
+          
+        // iterate through fully expanded words, if any
+        for (WordAff * q = exp_list; q; q = q->next) {
+          sl = to_soundslike_temp(q->word.str, q->word.size);
+          score = edit_dist_fun(sl, original_soundslike, parms->edit_distance_weights);
           if (score >= LARGE_NUM) continue;
-          stopped_at = LARGE_NUM;
           commit_temp(sl);
-          add_sound(i, sw, sl, score);
-          //CERR.printf("using %s: will add %s with score %d\n", *s, sl, (int)score);
-          break;
+          add_nearmiss(i, q, sl, -1, score, do_count);
         }
       }
     }
+    stopped_at0 = stopped_at;
+  }
+
+  template <class EditDistFun>
+  void Working::scan_dict_root(SpellerImpl::WS::const_iterator i,
+                               SoundslikeEnumeration * els, 
+                               int & stopped_at)
+  {
+    EditDistFun edit_dist_fun;
+    WordEntry * sw;
+    const char * sl = 0;
+    EditDist score;
+
+    while ( (sw = els->next(stopped_at)) ) {
+          
+      if (sw->what != WordEntry::Word) {
+        sl = sw->word;
+        abort_temp();
+      } else {
+        sl = to_soundslike_temp(*sw);
+      } 
+
+      stopped_at = LARGE_NUM;
+      for (const char * const * s = root_sls_begin; s != root_sls_end; ++s) {
+        score = edit_dist_fun(sl, *s, 
+                              parms->edit_distance_weights);
+        if (score.stopped_at - sl < stopped_at)
+          stopped_at = score.stopped_at - sl;
+        if (score >= LARGE_NUM) continue;
+        stopped_at = LARGE_NUM;
+        commit_temp(sl);
+        add_sound(i, sw, sl, score);
+        //CERR.printf("using %s: will add %s with score %d\n", *s, sl, (int)score);
+        break;
+      }
+    }
   }
 
   struct ReplTry 
@@ -940,6 +1104,7 @@ namespace {
 
   void Working::try_repl() 
   {
+    StageTimer timer(stats, StageRepl);
     String buf;
     Vector<ReplTry> repl_try;
     StackPtr<SuggestReplEnumeration> els(lang->repl());
@@ -983,6 +1148,18 @@ namespace {
     return (nscore - ((ns > 0) ? ns : 0));
   }
 
+  // returns true if s1 and s2 have a three character string in common
+  static bool have_trigram(const char * s1, int l1, const char * s2)
+  {
+    char t[4];
+    t[3] = '\0';
+    for (int i = 0; i + 3 <= l1; i++) {
+      memcpy(t, s1 + i, 3);
+      if (strstr(s2, t)) return true;
+    }
+    return false;
+  }
+
   struct NGramScore {
     SpellerImpl::WS::const_iterator i;
     WordEntry info;
@@ -997,6 +1174,7 @@ namespace {
 
   void Working::try_ngram()
   {
+    StageTimer timer(stats, StageNgram);
     String original_soundslike = original.soundslike;
     original_soundslike.ensure_null_end();
     WordEntry * sw = 0;
@@ -1015,11 +1193,26 @@ namespace {
       already_have.insert(i->soundslike);
     }
 
+    // ngram also scores the letters and pairs in common, so if the
+    // trigram index turns up fewer than ngram_keep candidates the
+    // entries it left out may still be among the best, in which case
+    // every entry is scored instead
+    bool use_index = true;
+  scan_again:
+    bool any_indexed = false;
     for (SpellerImpl::WS::const_iterator i = sp->suggest_ws.begin();
          i != sp->suggest_ws.end();
          ++i) 
     {
-      StackPtr<SoundslikeEnumeration> els((*i)->soundslike_elements());
+      // if the dictionary has a trigram index only the entries which
+      // share a trigram with the original are scored, the index may
+      // return a few others so they are skipped here
+      StackPtr<SoundslikeEnumeration> els;
+      if (use_index)
+        els.reset((*i)->soundslike_trigrams(original_soundslike));
+      bool indexed = els;
+      if (indexed) any_indexed = true;
+      else els.reset((*i)->soundslike_elements());
       
       while ( (sw = els->next(LARGE_NUM)) ) {
 
@@ -1032,6 +1225,10 @@ namespace {
         
         if (already_have.have(sl)) continue;
 
+        if (indexed && !have_trigram(original_soundslike.data(), 
+                                     original_soundslike.size(), sl)) 
+          continue;
+
         int ng = ngram(3, original_soundslike.data(), original_soundslike.size(),
                        sl, strlen(sl));
 
@@ -1059,6 +1256,14 @@ namespace {
         }
       }
     }
+
+    if (any_indexed && candidates.size() < (unsigned)parms->ngram_keep) {
+      candidates.clear();
+      min_score = 0;
+      count = 0;
+      use_index = false;
+      goto scan_again;
+    }
     
     for (Candidates::iterator i = candidates.begin();
          i != candidates.end();
@@ -1105,6 +1310,7 @@ namespace {
     }
 
   void Working::score_list(bool score_all) {
+    StageTimer timer(stats, StageScoreList);
 
 #  ifdef DEBUG_SUGGEST
     COUT.printl("SCORING LIST");
@@ -1367,6 +1573,7 @@ namespace {
 #endif
 
   void Working::fine_tune_score() {
+    StageTimer timer(stats, StageFineTuneScore);
 
     NearMisses::iterator i;
 
@@ -1431,9 +1638,9 @@ namespace {
  	  dup_pair = duplicates_check.insert(fix_case(i->repl_list->word, buf));
  	  if (dup_pair.second && 
  	      ((pos = dup_pair.first->find(' '), pos == String::npos)
- 	       ? (bool)sp->check(*dup_pair.first)
- 	       : (sp->check((String)dup_pair.first->substr(0,pos)) 
- 		  && sp->check((String)dup_pair.first->substr(pos+1))) ))
+ 	       ? check(*dup_pair.first)
+ 	       : (check((String)dup_pair.first->substr(0,pos)) 
+ 		  && check((String)dup_pair.first->substr(pos+1))) ))
  	    near_misses_final->push_back(*dup_pair.first);
  	} while (i->repl_list->adv());
       } else {
@@ -1471,17 +1678,38 @@ namespace {
     }
   };
 
+  // Finds the suggestions for one word of a batch.
+  struct BatchJob : public ParallelJob {
+    SpellerImpl * sp;
+    const char * word;
+    const SuggestParms * parms;
+    NearMissesFinal * res;
+    BatchJob(SpellerImpl * s, const char * w, const SuggestParms * p,
+             NearMissesFinal * r)
+      : sp(s), word(w), parms(p), res(r) {}
+    void run() {
+      Working sug(sp, &sp->lang(), word, parms);
+      sug.get_suggestions(*res);
+    }
+  };
+
   class SuggestImpl : public Suggest {
     SpellerImpl * speller_;
     SuggestionListImpl  suggestion_list;
+    Vector<SuggestionListImpl> batch_lists;
     SuggestParms parms_;
+    SuggestCache * cache_;
+    String cache_key_; // the part of the key for cache_ common to all words
+    void set_cache_key();
   public:
     PosibErr<void> setup(SpellerImpl * m);
     //SuggestImpl(SpellerImpl * m, const SuggestParms & p)
     //  : speller_(m), parms_(p) 
     //{parms_.fill_distance_lookup(m->config(), m->lang());}
     PosibErr<void> set_mode(ParmString mode) {
-      return parms_.set(mode, speller_);
+      RET_ON_ERR(parms_.set(mode, speller_));
+      set_cache_key();
+      return no_err;
     }
     double score(const char *base, const char *other) {
       //parms_.set_original_size(strlen(base));
@@ -1492,8 +1720,21 @@ namespace {
       //return sws.score;
       return -1;
     }
+    Suggest * clone() const;
     SuggestionList & suggest(const char * word);
+    void suggest(const char * const * words, unsigned num,
+                 SuggestionList * * lists);
   };
+
+  Suggest * SuggestImpl::clone() const
+  {
+    SuggestImpl * copy = new SuggestImpl;
+    copy->speller_ = speller_;
+    copy->parms_ = parms_;
+    copy->cache_ = cache_;
+    copy->cache_key_ = cache_key_;
+    return copy;
+  }
   
   PosibErr<void> SuggestImpl::setup(SpellerImpl * m)
   {
@@ -1513,32 +1754,199 @@ namespace {
       parms_.split_chars.push_back(*s);
     }
 
+    parms_.scan_threads = m->config()->retrieve_int("sug-threads");
+    parms_.batch_threads = m->config()->retrieve_int("sug-batch-threads");
+
     String keyboard = m->config()->retrieve("keyboard");
     if (keyboard == "none")
       parms_.use_typo_analysis = false;
     else
       RET_ON_ERR(aspell::sp::setup(parms_.ti, m->config(), &m->lang(), keyboard));
 
+    cache_ = &m->sug_cache;
+    set_cache_key();
+
     return no_err;
   }
 
+  template <typename T>
+  static inline void append_raw(String & key, const T & val)
+  {
+    key.append(&val, sizeof(T));
+  }
+
+  // The key for a word is cache_key_ followed by the word.  It needs
+  // to cover every parameter that can change the suggestions, and the
+  // dictionaries used, but not the per word weights as they only
+  // depend on the size of the word.
+  void SuggestImpl::set_cache_key()
+  {
+    const SuggestParms & p = parms_;
+    cache_key_.clear();
+    append_raw(cache_key_, p.edit_distance_weights);
+    append_raw(cache_key_, p.ti.get());
+    append_raw(cache_key_, p.try_one_edit_word);
+    append_raw(cache_key_, p.try_scan_1);
+    append_raw(cache_key_, p.try_scan_2);
+    append_raw(cache_key_, p.try_ngram);
+    append_raw(cache_key_, p.ngram_threshold);
+    append_raw(cache_key_, p.ngram_keep);
+    append_raw(cache_key_, p.check_after_one_edit_word);
+    append_raw(cache_key_, p.use_typo_analysis);
+    append_raw(cache_key_, p.use_repl_table);
+    append_raw(cache_key_, p.normal_soundslike_weight);
+    append_raw(cache_key_, p.small_word_soundslike_weight);
+    append_raw(cache_key_, p.small_word_threshold);
+    append_raw(cache_key_, p.skip);
+    append_raw(cache_key_, p.span);
+    append_raw(cache_key_, p.limit);
+    cache_key_ += p.split_chars;
+    cache_key_ += '\0';
+    SpellerImpl::WS::const_iterator i = speller_->suggest_ws.begin();
+    for (; i != speller_->suggest_ws.end(); ++i)
+      append_raw(cache_key_, *i);
+    cache_key_ += '\0';
+  }
+
   SuggestionList & SuggestImpl::suggest(const char * word) { 
 #   ifdef DEBUG_SUGGEST
     COUT << "=========== begin suggest " << word << " ===========\n";
 #   endif
+    String key = cache_key_;
+    key += word;
+    if (cache_->lookup(key, suggestion_list.suggestions))
+      return suggestion_list;
     parms_.set_original_word_size(strlen(word));
     suggestion_list.suggestions.resize(0);
     Working sug(speller_, &speller_->lang(),word,&parms_);
     sug.get_suggestions(suggestion_list.suggestions);
+    cache_->insert(key, suggestion_list.suggestions);
 #   ifdef DEBUG_SUGGEST
     COUT << "^^^^^^^^^^^  end suggest " << word << "  ^^^^^^^^^^^\n";
 #   endif
     return suggestion_list;
   }
-  
+
+  void SuggestImpl::suggest(const char * const * words, unsigned num,
+                            SuggestionList * * lists) 
+  {
+    // The parms depend on the size of the word so use one copy for
+    // small words and one for the rest.  The threads are used to work
+    // on several words at once rather than to scan each dictionary
+    // in parts.
+    SuggestParms small_parms(parms_), normal_parms(parms_);
+    small_parms.scan_threads = normal_parms.scan_threads = 1;
+    small_parms.set_original_word_size(parms_.small_word_threshold);
+    normal_parms.set_original_word_size(parms_.small_word_threshold + 1);
+    batch_lists.resize(num);
+    Vector<BatchJob> jobs;
+    jobs.reserve(num);
+    // A document will often have the same misspelling more than once,
+    // so only find the suggestions for each distinct word once.
+    hash_map<String, unsigned, HashString<String> > seen;
+    String key;
+    for (unsigned i = 0; i != num; ++i) {
+      pair<hash_map<String, unsigned, HashString<String> >::iterator, bool> 
+        res = seen.insert(make_pair(String(words[i]), i));
+      lists[i] = &batch_lists[res.first->second];
+      if (!res.second) continue;
+      key = cache_key_;
+      key += words[i];
+      if (cache_->lookup(key, batch_lists[i].suggestions)) continue;
+      batch_lists[i].suggestions.resize(0);
+      int size = strlen(words[i]);
+      jobs.push_back(BatchJob(speller_, words[i],
+                              size <= parms_.small_word_threshold 
+                              ? &small_parms : &normal_parms,
+                              &batch_lists[i].suggestions));
+    }
+    if (jobs.empty()) return;
+    Vector<ParallelJob *> job_ptrs;
+    for (Vector<BatchJob>::iterator j = jobs.begin(); j != jobs.end(); ++j)
+      job_ptrs.push_back(&*j);
+    run_parallel(job_ptrs.pbegin(), job_ptrs.size(), parms_.batch_threads);
+    for (Vector<BatchJob>::iterator j = jobs.begin(); j != jobs.end(); ++j) {
+      key = cache_key_;
+      key += j->word;
+      cache_->insert(key, *j->res);
+    }
+  }
+
 }
 
 namespace aspell { namespace sp {
+  //
+  // SuggestCache
+  //
+
+  SuggestCache::SuggestCache() 
+    : max_size_(0), hits_(0), misses_(0) 
+  {
+    head_.prev = head_.next = &head_;
+  }
+
+  SuggestCache::~SuggestCache()
+  {
+    evict(0);
+  }
+
+  void SuggestCache::evict(unsigned size)
+  {
+    while (lookup_.size() > size) {
+      Node * n = head_.prev;
+      unlink(n);
+      lookup_.erase(n->key);
+      delete n;
+    }
+  }
+
+  void SuggestCache::set_max_size(unsigned size)
+  {
+    LOCK(&lock_);
+    max_size_ = size;
+    evict(size);
+  }
+
+  bool SuggestCache::lookup(const String & key, Value & res)
+  {
+    LOCK(&lock_);
+    if (max_size_ == 0) return false;
+    Lookup::iterator i = lookup_.find(key);
+    if (i == lookup_.end()) {
+      ++misses_;
+      return false;
+    }
+    ++hits_;
+    Node * n = i->second;
+    unlink(n);
+    link_front(n);
+    res = n->value;
+    return true;
+  }
+
+  void SuggestCache::insert(const String & key, const Value & val)
+  {
+    LOCK(&lock_);
+    if (max_size_ == 0) return;
+    pair<Lookup::iterator, bool> res = lookup_.insert(make_pair(key, (Node *)0));
+    if (res.second) {
+      res.first->second = new Node;
+      res.first->second->key = key;
+    } else {
+      unlink(res.first->second);
+    }
+    Node * n = res.first->second;
+    n->value = val;
+    link_front(n);
+    evict(max_size_);
+  }
+
+  void SuggestCache::clear()
+  {
+    LOCK(&lock_);
+    evict(0);
+  }
+
   PosibErr<Suggest *> new_default_suggest(SpellerImpl * m) {
     StackPtr<SuggestImpl> s(new SuggestImpl);
     RET_ON_ERR(s->setup(m));
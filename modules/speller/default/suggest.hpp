@@ -3,9 +3,14 @@
 #ifndef ASPELLER_SUGGEST__HPP
 #define ASPELLER_SUGGEST__HPP
 
+#include <vector>
+
 #include "word_list.hpp"
 #include "enumeration.hpp"
 #include "parm_string.hpp"
+#include "hash.hpp"
+#include "hash_fun.hpp"
+#include "lock.hpp"
 
 
 namespace aspell { namespace sp {
@@ -30,13 +35,62 @@ namespace aspell { namespace sp {
 
   class Suggest {
   public:
+    // the copy shares the parameters and the cache but has its own
+    // buffers, so that it can be used by another thread
+    virtual Suggest * clone() const = 0;
     virtual PosibErr<void> set_mode(ParmString) = 0;
     virtual double score(const char * base, const char * other) = 0;
     virtual SuggestionList & suggest(const char * word) = 0;
+    // the lists returned are only valid until the next call to this
+    // version of suggest
+    virtual void suggest(const char * const * words, unsigned num,
+                         SuggestionList * * lists) = 0;
     virtual ~Suggest() {}
   };
   
   PosibErr<Suggest *> new_default_suggest(SpellerImpl *);
+
+  // A bounded cache of suggestion results which throws away the least
+  // recently used entry when full.  It may be used from several
+  // threads at once.  The key is made up by Suggest and includes
+  // everything that the result depends on besides the contents of
+  // the dictionaries, so the cache must be cleared when they change.
+  class SuggestCache {
+  public:
+    typedef std::vector<String> Value;
+    SuggestCache();
+    ~SuggestCache();
+    void set_max_size(unsigned);
+    // returns false, and leaves res alone, if key is not in the cache
+    bool lookup(const String & key, Value & res);
+    void insert(const String & key, const Value & val);
+    void clear();
+    unsigned max_size() const {return max_size_;}
+    unsigned hits() const {return hits_;}
+    unsigned misses() const {return misses_;}
+  private:
+    struct Node {
+      String key;
+      Value value;
+      Node * prev;
+      Node * next;
+    };
+    typedef hash_map<String, Node *, HashString<String> > Lookup;
+    Lookup lookup_;
+    Node head_; // head_.next is the most recently used
+    unsigned max_size_;
+    unsigned hits_;
+    unsigned misses_;
+    Mutex lock_;
+    void unlink(Node * n) {n->prev->next = n->next; n->next->prev = n->prev;}
+    void link_front(Node * n) {
+      n->prev = &head_; n->next = head_.next; 
+      head_.next->prev = n; head_.next = n;
+    }
+    void evict(unsigned size);
+    SuggestCache(const SuggestCache &);
+    void operator=(const SuggestCache &);
+  };
 } }
 
 
@@ -15,6 +15,8 @@
 #include "fstream.hpp"
 #include "lang_impl.hpp"
 #include "getdata.hpp"
+#include "vararray.hpp"
+#include "vector_hash-t.hpp"
 
 namespace {
 
@@ -75,6 +77,54 @@ struct WordReplRec
   const WordRec * word_rec() const { return &misspelled; }
 };
 
+//
+// A word in a WritableDict.  Words with the same soundslike are
+// chained together through next_ in the order they were added.
+// WordRec is variable length and must be last.
+//
+struct WordNode
+{
+  WordNode * next_;
+  WordRec    rec; // this must be the last element in the structure
+  const char * key() const { return rec.word_; }
+  const WordRec * word_rec() const { return &rec; }
+};
+
+//
+// The words in a WritableDict with the same soundslike.  The
+// soundslike is variable length and must be last.
+//
+struct SoundslikeBucket
+{
+  WordNode * first;
+  WordNode * last;
+  char sl[1]; // this must be the last element in the structure
+  const char * key() const { return sl; }
+};
+
+//
+// VectorHashTable params for a table of record pointers, the records
+// themselves are kept in an ObjStack
+//
+template <typename Rec, typename H, typename E, bool multi>
+struct PtrLookupParms
+{
+  typedef aspell::Vector<Rec *> Vector;
+  typedef Rec *                 Value;
+  typedef const char *          Key;
+  static const bool is_multi = multi;
+  PtrLookupParms(const H & h = H(), const E & e = E()) : hash(h), equal(e) {}
+  H hash;
+  E equal;
+  Key key(Value v) const {return v->key();}
+  bool is_nonexistent(Value v) const {return v == 0;}
+  void make_nonexistent(Value & v) const {v = 0;}
+};
+
+struct StrEqual {
+  bool operator() (Str a, Str b) const {return strcmp(a, b) == 0;}
+};
+
 //
 // Hash table params for a writable dictionary word record pointer
 //
@@ -137,23 +187,35 @@ class WritableBase : public Dictionary {
 protected:
   String suffix;
   String compatibility_suffix;
+  String header_magic; // the first word of the header line
     
+  // What the file looked like when it was last read or written, used
+  // to tell if another process has only appended to it since
   time_t cur_file_date;
+  long   cur_file_size;
+  String cur_file_header;
   
   String compatibility_file_name;
     
-  WritableBase(BasicType t, const char * n, const char * s, const char * cs)
+  WritableBase(BasicType t, const char * n, const char * s, const char * cs,
+               const char * m)
     : Dictionary(t,n),
-      suffix(s), compatibility_suffix(cs),
+      suffix(s), compatibility_suffix(cs), header_magic(m),
+      cur_file_date(0), cur_file_size(0),
       personal_no_hint(false), personal_sort(false),
       use_soundslike(true) {fast_lookup = true;}
   virtual ~WritableBase() {}
   
   virtual PosibErr<void> save(FStream &, ParmString) = 0;
   virtual PosibErr<void> merge(FStream &, ParmString, Config * = 0) = 0;
+  // merges the lines which follow the header
+  virtual PosibErr<void> merge_tail(FStream &, ParmString) = 0;
+  // writes the lines for the records in unsaved
+  virtual void save_unsaved(FStream &) = 0;
     
   PosibErr<void> save2(FStream &, ParmString);
   PosibErr<void> update(FStream &, ParmString);
+  PosibErr<bool> append(FStream &, bool do_update);
   PosibErr<void> save(bool do_update);
   PosibErr<void> update_file_date_info(FStream &);
   PosibErr<void> load(ParmString, Config &, DictList *, SpellerImpl *);
@@ -176,12 +238,20 @@ protected:
 
   bool use_soundslike;
   ObjStack             buffer;
+
+  // The records added since the file was last read or written in the
+  // order they were added.  A replacement is stored as two records,
+  // the misspelled word followed by the correction.
+  Vector<const WordRec *> unsaved;
  
 };
 
 PosibErr<void> WritableBase::update_file_date_info(FStream & f) {
   RET_ON_ERR(update_file_info(f));
   cur_file_date = get_modification_time(f);
+  cur_file_size = get_file_size(f);
+  f.restart();
+  f.getline(cur_file_header);
   return no_err;
 }
   
@@ -201,6 +271,7 @@ PosibErr<void> WritableBase::load(ParmString f0, Config & config,
     if (in.peek() == EOF) return make_err(cant_read_file,f); 
     // ^^ FIXME 
     RET_ON_ERR(merge(in, f, &config));
+    unsaved.clear();
       
   } else if (f.substr(f.size()-suffix.size(),suffix.size()) 
              == suffix) {
@@ -261,21 +332,79 @@ PosibErr<void> WritableBase::save_as(ParmString fn) {
   FStream inout;
   RET_ON_ERR(open_file_writelock(inout, file_name()));
   RET_ON_ERR(save2(inout, file_name()));
+  unsaved.clear();
   RET_ON_ERR(update_file_date_info(inout));
   return no_err;
 }
 
+//
+// Try to save by appending the unsaved records to the end of the
+// file.  If another process has appended to the file since it was
+// last read or written the new lines are merged in first.  Returns
+// false without writing anything if the whole file needs to be
+// rewritten instead, which is the case when the file was rewritten
+// by someone else, is in an older format, or has grown to more than
+// twice the size given in its header (so that rewriting it is
+// amortized over the appends).
+//
+PosibErr<bool> WritableBase::append(FStream & inout, bool do_update)
+{
+  if (personal_sort || cur_file_header.empty()) return false;
+
+  String header;
+  inout.getline(header);
+  long file_size = get_file_size(inout);
+  if (header != cur_file_header || file_size < cur_file_size) return false;
+
+  const char * p = header.str();
+  if (strncmp(p, header_magic.str(), header_magic.size()) != 0
+      || p[header_magic.size()] != ' ') return false;
+  p = strchr(p + header_magic.size() + 1, ' '); // skip the language
+  unsigned long hint = p ? strtoul(p, 0, 10) : 0;
+
+  if (file_size == cur_file_size 
+      && get_modification_time(inout) != cur_file_date) return false;
+
+  if (file_size > cur_file_size) {
+    if (!do_update) return false;
+    inout.seek(cur_file_size - 1);
+    if (inout.get() != '\n') return false;
+    unsigned int prev = unsaved.size();
+    RET_ON_ERR(merge_tail(inout, file_name()));
+    unsaved.resize(prev);
+    cur_file_date = get_modification_time(inout);
+    cur_file_size = file_size;
+  }
+
+  if (size() > 2 * hint + 64) return false;
+
+  if (unsaved.empty()) return true;
+  inout.seek(0, SEEK_END);
+  save_unsaved(inout);
+  RET_ON_ERR(sync_file(inout, file_name()));
+  unsaved.clear();
+  RET_ON_ERR(update_file_date_info(inout));
+  return true;
+}
+
 PosibErr<void> WritableBase::save(bool do_update) {
   FStream inout;
   RET_ON_ERR_SET(open_file_writelock(inout, file_name()),
                  bool, prev_existed);
 
+  if (prev_existed && compatibility_file_name.empty()) {
+    RET_ON_ERR_SET(append(inout, do_update), bool, appended);
+    if (appended) return no_err;
+    inout.restart();
+  }
+
   if (do_update
       && prev_existed 
       && get_modification_time(inout) > cur_file_date)
     RET_ON_ERR(update(inout, file_name()));
 
   RET_ON_ERR(save2(inout, file_name()));
+  unsaved.clear();
   RET_ON_ERR(update_file_date_info(inout));
     
   if (compatibility_file_name.size() != 0) {
@@ -388,26 +517,23 @@ struct ElementsParms {
 
 static void soundslike_next(WordEntry * w)
 {
-  const WordRec *const * &i  = (const WordRec *const *&)(w->intr[0]);
-  const WordRec *const * end = (const WordRec *const *) (w->intr[1]);
-  set_word(*w, (*i)->word_rec());
-  ++i;
-  if (i == end) w->adv_ = 0;
+  const WordNode * n = static_cast<const WordNode *>(w->intr[0]);
+  set_word(*w, n->word_rec());
+  w->intr[0] = (void *)n->next_;
+  if (!n->next_) w->adv_ = 0;
 }
 
-static void sl_init( WordRec *const * i,
-						   WordRec *const * end, WordEntry & o)
+static void sl_init(const WordNode * n, WordEntry & o)
 {
-  set_word(o, (*i)->word_rec());
-  ++i;
-  if (i != end) {
-    o.intr[0] = (void *)i;
-    o.intr[1] = (void *)end;
+  set_word(o, n->word_rec());
+  if (n->next_) {
+    o.intr[0] = (void *)n->next_;
     o.adv_ = soundslike_next;
   } else {
     o.intr[0] = 0;
   }
 }
+
 static void soundslike_next_repl(WordEntry * w)
 {
   const WordReplRec *const * &i  = (const WordReplRec *const *&)(w->intr[0]);
@@ -438,18 +564,28 @@ static void sl_init( WordReplRec *const * i,
 class WritableDict : public WritableBase
 {
 public:
-  // The key is the soundslike string, the value is the vector of words
-  typedef WordVec LookupVec;
-  typedef hash_map<Str,LookupVec> SoundslikeLookup;
-  typedef HashTable<LookupParams<WordRec *> > WordLookup;
+  // The words and soundslike buckets are allocated from buffer, the
+  // lookup tables only store pointers to them
+  typedef PtrLookupParms<WordNode, Hash, Equal, true> WordLookupParms;
+  typedef VectorHashTable<WordLookupParms> WordLookup;
+  typedef PtrLookupParms<SoundslikeBucket, aspell::hash<Str>, StrEqual, false> 
+          SoundslikeLookupParms;
+  typedef VectorHashTable<SoundslikeLookupParms> SoundslikeLookup;
+  // The key is three characters of a soundslike packed into an
+  // integer, the value is the SoundslikeBuckets (or the WordNodes
+  // when the soundslike is not used) with a soundslike containing them
+  typedef hash_map<unsigned int, Vector<const void *> > TrigramLookup;
 
 public: // but don't use
   PosibErr<void> save(FStream &, ParmString);
   PosibErr<void> merge(FStream &, ParmString, Config * config);
+  PosibErr<void> merge_tail(FStream &, ParmString);
+  void save_unsaved(FStream &);
 
 public:
 
-  WritableDict() : WritableBase(basic_dict, "WritableDict", ".pws", ".per") {}
+  WritableDict() : WritableBase(basic_dict, "WritableDict", ".pws", ".per",
+                                "personal_ws-1.1") {}
 
   Size   size()     const;
   bool   empty()    const;
@@ -468,16 +604,19 @@ public:
   WordEntryEnumeration * detailed_elements() const;
 
   SoundslikeEnumeration * soundslike_elements() const;
+  SoundslikeEnumeration * soundslike_trigrams(ParmString) const;
   void set_lang_hook(Config & c) {
     set_file_encoding(lang()->data_encoding(), c);
-    word_lookup.reset(new WordLookup(10,LookupParams<WordRec *>(
-		 Hash(lang()), Equal(lang()))));
+    word_lookup.reset(new WordLookup(WordLookupParms(Hash(lang()), Equal(lang()))));
     use_soundslike = lang()->have_soundslike();
   }
 protected:
   StackPtr<WordLookup> word_lookup;
   SoundslikeLookup     soundslike_lookup_;
+  TrigramLookup        trigram_lookup_;
 
+  void add_trigrams(const char * sl, const void * entry);
+  const WordLookup & words() const {return *word_lookup;}
 };
 
 WritableDict::Size WritableDict::size() const 
@@ -492,9 +631,12 @@ bool WritableDict::empty() const
 
 PosibErr<void> WritableDict::clear() 
 {
-  word_lookup->clear();
-  soundslike_lookup_.clear();
+  WordLookup(word_lookup->parms()).swap(*word_lookup);
+  SoundslikeLookup().swap(soundslike_lookup_);
+  trigram_lookup_.clear();
   buffer.reset();
+  unsaved.clear();
+  cur_file_header.clear();
   return no_err;
 }
 
@@ -502,15 +644,14 @@ bool WritableDict::lookup(ParmString word, const SensitiveCompare * c,
                           WordEntry & o) const
 {
   o.clear();
-  pair<WordLookup::iterator, WordLookup::iterator> p(word_lookup->equal_range(word));
-  while (p.first != p.second) {
-    WordRec * w= *p.first;
+  WordLookup::ConstFindIterator i = words().multi_find(word);
+  for (; !i.at_end(); i.adv()) {
+    const WordNode * w = i.deref();
     if ((*c)(word,w->key())) {
       o.what = WordEntry::Word;
-      set_word(o, w);
+      set_word(o, w->word_rec());
       return true;
     }
-    ++p.first;
   }
   return false;
 }
@@ -518,11 +659,10 @@ bool WritableDict::lookup(ParmString word, const SensitiveCompare * c,
 bool WritableDict::clean_lookup(const char * sl, WordEntry & o) const
 {
   o.clear();
-  pair<WordLookup::iterator, WordLookup::iterator> p(word_lookup->equal_range(sl));
-  if (p.first == p.second) return false; // empty
+  WordLookup::ConstFindIterator i = words().multi_find(sl);
+  if (i.at_end()) return false; // empty
   o.what = WordEntry::Word;
-  WordRec *rec = *p.first;
-  set_word(o, rec);
+  set_word(o, i.deref()->word_rec());
   return true;
   // FIXME: Deal with multiple entries
 }  
@@ -531,12 +671,12 @@ bool WritableDict::soundslike_lookup(const WordEntry & word, WordEntry & o) cons
 {
   if (use_soundslike) {
 
-    const LookupVec * tmp 
-      = (const LookupVec *)(word.intr[0]);
+    const SoundslikeBucket * b
+      = (const SoundslikeBucket *)(word.intr[0]);
     o.clear();
 
     o.what = WordEntry::Word;
-    sl_init(tmp->pbegin(),tmp->pend(), o);
+    sl_init(b->first, o);
 
   } else {
       
@@ -560,8 +700,7 @@ bool WritableDict::soundslike_lookup(ParmString word, WordEntry & o) const
       return false;
     } else {
       o.what = WordEntry::Word;
-      LookupVec *v = &(i->second);
-      sl_init(v->pbegin(), v->pend(), o);
+      sl_init((*i)->first, o);
       return true;
     }
   
@@ -572,26 +711,107 @@ bool WritableDict::soundslike_lookup(ParmString word, WordEntry & o) const
   }
 }
 
+// Store soundslike bucket data in a WordEntry object.
+static inline void set_bucket(WordEntry & res, const SoundslikeBucket * b)
+{
+  res.what = WordEntry::Soundslike;
+  set_sl(res, b->sl);
+  res.intr[0] = (void *)b;
+}
+
+// An enumeration of the soundslike buckets of a WritableDict.
+struct BucketElements : public SoundslikeEnumeration {
+
+  typedef WritableDict::SoundslikeLookup::const_iterator Itr;
+
+  Itr i;
+  Itr end;
+
+  WordEntry d;
+
+  BucketElements(Itr i0, Itr end0) : i(i0), end(end0) {}
+
+  WordEntry * next(int) {
+    if (i == end) return 0;
+    set_bucket(d, *i);
+    ++i;
+    return &d;
+  }
+};
+
 SoundslikeEnumeration * WritableDict::soundslike_elements() const
 {
   if (use_soundslike)
-    return new SoundslikeElements<SoundslikeLookup>(soundslike_lookup_.begin(), 
-                                                    soundslike_lookup_.end());
+    return new BucketElements(soundslike_lookup_.begin(), 
+                              soundslike_lookup_.end());
   else
-    return new CleanElements<WordLookup>(word_lookup->begin(),
-                                         word_lookup->end());
+    return new CleanElements<WordLookup>(words().begin(), words().end());
+}
+
+static inline unsigned int pack_trigram(const char * p)
+{
+  const unsigned char * b = reinterpret_cast<const unsigned char *>(p);
+  return (b[0] << 16) | (b[1] << 8) | b[2];
+}
+
+void WritableDict::add_trigrams(const char * sl, const void * entry)
+{
+  for (; sl[0] && sl[1] && sl[2]; ++sl)
+    trigram_lookup_[pack_trigram(sl)].push_back(entry);
+}
+
+// An enumeration of the entries found in trigram_lookup_, each entry
+// is either a SoundslikeBucket or a WordNode
+struct TrigramElements : public SoundslikeEnumeration {
+
+  Vector<const void *> entries;
+  Vector<const void *>::const_iterator i;
+  bool use_soundslike;
+
+  WordEntry d;
+
+  TrigramElements(bool sl) : use_soundslike(sl) {}
+
+  WordEntry * next(int) {
+    if (i == entries.end()) return 0;
+    if (use_soundslike) {
+      set_bucket(d, static_cast<const SoundslikeBucket *>(*i));
+    } else {
+      d.what = WordEntry::Word;
+      set_word(d, static_cast<const WordNode *>(*i)->word_rec());
+    }
+    ++i;
+    return &d;
+  }
+};
+
+SoundslikeEnumeration * WritableDict::soundslike_trigrams(ParmString sl) const
+{
+  if (sl.size() < 3) return 0;
+  TrigramElements * els = new TrigramElements(use_soundslike);
+  for (const char * p = sl, * e = sl + sl.size() - 2; p != e; ++p) {
+    TrigramLookup::const_iterator j = trigram_lookup_.find(pack_trigram(p));
+    if (j == trigram_lookup_.end()) continue;
+    els->entries.insert(els->entries.end(), j->second.begin(), j->second.end());
+  }
+  std::sort(els->entries.begin(), els->entries.end());
+  els->entries.erase(std::unique(els->entries.begin(), els->entries.end()), 
+                     els->entries.end());
+  els->i = els->entries.begin();
+  return els;
 }
 
 WritableDict::Enum * WritableDict::detailed_elements() const
 {
   typedef ElementsParms<WordLookup> WordElements;
   return new MakeEnumeration<WordElements>
-    (word_lookup->begin(),WordElements(word_lookup->end()));
+    (words().begin(),WordElements(words().end()));
 }
 
 //
 // Add a word and soundlike to the dictionary.
-// we allocate a buffers with these implied structure:
+// The WordNode and, for a new soundslike, the SoundslikeBucket are
+// allocated from buffer.
 //
 PosibErr<void> WritableDict::add(ParmString w, ParmString s)
 {
@@ -599,15 +819,32 @@ PosibErr<void> WritableDict::add(ParmString w, ParmString s)
   SensitiveCompare c(lang());
   WordEntry we;
   if (WritableDict::lookup(w,&c,we)) return no_err;
-  WordRec *rec = static_cast<WordRec *>(buffer.alloc(sizeof(WordRec) + w.size()));
-  rec->word_info_ = lang()->get_word_info(w);
-  rec->size_ = w.size();
-  memcpy(rec->word_, w.str(), w.size() + 1);
-  word_lookup->insert(rec);
+  WordNode * node = static_cast<WordNode *>
+    (buffer.alloc(sizeof(WordNode) + w.size(), sizeof(void *)));
+  node->next_ = 0;
+  node->rec.word_info_ = lang()->get_word_info(w);
+  node->rec.size_ = w.size();
+  memcpy(node->rec.word_, w.str(), w.size() + 1);
+  word_lookup->insert(node);
+  unsaved.push_back(&node->rec);
   if (use_soundslike) {
-    char *soundslike = static_cast<char *>(buffer.alloc(s.size() +1));
-    memcpy(soundslike,s.str(), s.size() + 1);
-    soundslike_lookup_[soundslike].push_back(rec);
+    SoundslikeLookup::iterator i = soundslike_lookup_.find(s);
+    if (i != soundslike_lookup_.end()) {
+      (*i)->last->next_ = node;
+      (*i)->last = node;
+    } else {
+      SoundslikeBucket * b = static_cast<SoundslikeBucket *>
+        (buffer.alloc(sizeof(SoundslikeBucket) + s.size(), sizeof(void *)));
+      b->first = node;
+      b->last = node;
+      memcpy(b->sl, s.str(), s.size() + 1);
+      soundslike_lookup_.insert(b);
+      add_trigrams(b->sl, b);
+    }
+  } else {
+    VARARRAY(char, sl, w.size() + 1);
+    lang()->LangImpl::to_soundslike(sl, w.str(), w.size());
+    add_trigrams(sl, node);
   }
   return no_err;
 }
@@ -640,20 +877,28 @@ PosibErr<void> WritableDict::merge(FStream & in,
       return pe.with_file(file_name);
   }
 
-  split(dp); // count not used at the moment
+  split(dp);
+  {
+    // the count is only a hint but it saves growing the table over
+    // and over when loading a large list
+    int count = atoi(dp.key);
+    if (count > 0 && count < (1 << 24)
+        && (word_lookup->size() + count) * 5 / 4 > word_lookup->bucket_count())
+      word_lookup->resize((word_lookup->size() + count) * 5 / 4);
+  }
 
   split(dp);
   if (dp.key.size > 0)
     set_file_encoding(dp.key, *config);
   else
     set_file_encoding("", *config);
+
+  if (ver == 11)
+    return merge_tail(in, file_name);
   
   ConvP conv(iconv);
   while (getline_n_unescape(in, dp, buf)) {
-    if (ver == 10)
-      split(dp);
-    else
-      dp.key = dp.value;
+    split(dp);
     Ret pe = add(conv(dp.key));
     if (pe.has_err()) {
       clear(); //fixme: the output error does not indicate which key was not supported.
@@ -663,6 +908,22 @@ PosibErr<void> WritableDict::merge(FStream & in,
   return no_err;
 }
 
+PosibErr<void> WritableDict::merge_tail(FStream & in, ParmString file_name)
+{
+  typedef PosibErr<void> Ret;
+  String buf;
+  DataPair dp;
+  ConvP conv(iconv);
+  while (getline_n_unescape(in, dp, buf)) {
+    Ret pe = add(conv(dp.value));
+    if (pe.has_err()) {
+      clear(); //fixme: the output error does not indicate which key was not supported.
+      return pe.with_file(file_name);
+    }
+  }
+  return no_err;
+}
+
 template <typename InputIterator>
 inline void WritableBase::save_words(FStream& out, InputIterator i, InputIterator e)
 {
@@ -687,10 +948,11 @@ PosibErr<void> WritableDict::save(FStream & out, ParmString file_name)
              lang_name(), size, file_encoding.c_str());
 
   if (personal_sort) {
-    // WordVec sorted_words(word_lookup->begin(), word_lookup->end());
-    // WordVec doesn't support the iterator copy constructor
-    WordVec sorted_words;
-    sorted_words.assign(word_lookup->begin(), word_lookup->end());
+    Vector<const WordRec *> sorted_words;
+    sorted_words.reserve(word_lookup->size());
+    WordLookup::const_iterator i = words().begin(), e = words().end();
+    for (; i != e; ++i)
+      sorted_words.push_back((*i)->word_rec());
     // NOTE: std::sort is likely an overkill here
     std::sort(sorted_words.begin(), sorted_words.end(), compare_word_rec);
     save_words(out, sorted_words.begin(), sorted_words.end());
@@ -701,6 +963,11 @@ PosibErr<void> WritableDict::save(FStream & out, ParmString file_name)
   return no_err;
 }
 
+void WritableDict::save_unsaved(FStream & out)
+{
+  save_words(out, unsaved.begin(), unsaved.end());
+}
+
 /////////////////////////////////////////////////////////////////////
 // 
 //  WritableReplList
@@ -718,7 +985,8 @@ public:
   WritableReplDict& operator=(const WritableReplDict&);
 
 public:
-  WritableReplDict() : WritableBase(replacement_dict, "WritableReplDict", ".prepl",".rpl") 
+  WritableReplDict() : WritableBase(replacement_dict, "WritableReplDict", ".prepl",".rpl",
+                                    "personal_repl-1.1") 
   {
     fast_lookup = true;
   }
@@ -754,6 +1022,8 @@ public:
 private:
   PosibErr<void> save(FStream &, ParmString );
   PosibErr<void> merge(FStream &, ParmString , Config * config);
+  PosibErr<void> merge_tail(FStream &, ParmString);
+  void save_unsaved(FStream &);
   StackPtr<WordLookup>   word_lookup;
   SoundslikeLookup soundslike_lookup_;
 };
@@ -773,6 +1043,8 @@ PosibErr<void> WritableReplDict::clear()
   word_lookup->clear();
   soundslike_lookup_.clear();
   buffer.reset();
+  unsaved.clear();
+  cur_file_header.clear();
   return no_err;
 }
     
@@ -958,6 +1230,8 @@ PosibErr<void> WritableReplDict::add_repl(ParmString mis, ParmString cor, ParmSt
   rec->size_ = cor.size();
   memcpy(rec->word_, cor.str(), cor.size() + 1);
   v.push_back(rec);
+  unsaved.push_back(&repl->misspelled);
+  unsaved.push_back(rec);
 
   if (use_soundslike) {
     // Allocate space for the soundslike string, save the Word/Replace record
@@ -971,7 +1245,10 @@ PosibErr<void> WritableReplDict::add_repl(ParmString mis, ParmString cor, ParmSt
 
 PosibErr<void> WritableReplDict::save (FStream & out, ParmString file_name) 
 {
-  out.printf("personal_repl-1.1 %s 0 %s\n", lang_name(), file_encoding.c_str());
+  int size = personal_no_hint ? 0 : word_lookup->size();
+
+  out.printf("personal_repl-1.1 %s %i %s\n", 
+             lang_name(), size, file_encoding.c_str());
   
   WordLookup::iterator i = word_lookup->begin();
   WordLookup::iterator e = word_lookup->end();
@@ -994,6 +1271,21 @@ PosibErr<void> WritableReplDict::save (FStream & out, ParmString file_name)
   return no_err;
 }
 
+void WritableReplDict::save_unsaved(FStream & out)
+{
+  ConvP conv1(oconv);
+  ConvP conv2(oconv);
+
+  for (Vector<const WordRec *>::iterator i = unsaved.begin(); 
+       i != unsaved.end(); i += 2)
+  {
+    write_n_escape(out, conv1(i[0]->key()));
+    out << ' ';
+    write_n_escape(out, conv2(i[1]->key()));
+    out << '\n';
+  }
+}
+
 PosibErr<void> WritableReplDict::merge(FStream & in,
                                        ParmString file_name, 
                                        Config * config)
@@ -1039,19 +1331,7 @@ PosibErr<void> WritableReplDict::merge(FStream & in,
 
   if (version == 11) {
 
-    ConvP conv1(iconv);
-    ConvP conv2(iconv);
-    for (;;) {
-      bool res = getline_n_unescape(in, buf, '\n');
-      if (!res) break;
-      char * mis = buf.mstr();
-      char * repl = strchr(mis, ' ');
-      if (!repl) continue; // bad line, ignore
-      *repl = '\0'; // split string
-      ++repl;
-      if (!repl[0]) continue; // empty repl, ignore
-      WritableReplDict::add_repl(conv1(mis), conv2(repl));
-    }
+    return merge_tail(in, file_name);
     
   } else {
     
@@ -1073,6 +1353,25 @@ PosibErr<void> WritableReplDict::merge(FStream & in,
   return no_err;
 }
 
+PosibErr<void> WritableReplDict::merge_tail(FStream & in, ParmString)
+{
+  String buf;
+  ConvP conv1(iconv);
+  ConvP conv2(iconv);
+  for (;;) {
+    bool res = getline_n_unescape(in, buf, '\n');
+    if (!res) break;
+    char * mis = buf.mstr();
+    char * repl = strchr(mis, ' ');
+    if (!repl) continue; // bad line, ignore
+    *repl = '\0'; // split string
+    ++repl;
+    if (!repl[0]) continue; // empty repl, ignore
+    WritableReplDict::add_repl(conv1(mis), conv2(repl));
+  }
+  return no_err;
+}
+
 WritableReplDict::~WritableReplDict()
 {
   WordLookup::iterator i = word_lookup->begin();
@@ -51,6 +51,7 @@
 #include "string_enumeration.hpp"
 #include "string_map.hpp"
 #include "word_list.hpp"
+#include "parallel.hpp"
 
 #include "string_list.hpp"
 #include "speller_impl.hpp"
@@ -71,10 +72,12 @@ void config();
 
 void check();
 void pipe();
+void batch();
 void convt();
 void normlz();
 void filter();
 void list();
+void stats();
 void dicts();
 void modes();
 void filters();
@@ -169,7 +172,9 @@ const PossibleOption possible_options[] = {
   COMMAND("dicts",     '\0', 0),
   COMMAND("check",     'c',  0),
   COMMAND("pipe",      'a',  0),
+  COMMAND("batch",     '\0', 0),
   COMMAND("list",      '\0', 0),
+  COMMAND("stats",     '\0', 0),
   COMMAND("conv",      '\0', 2),
   COMMAND("norm",      '\0', 1),
   COMMAND("filter",    '\0', 0),
@@ -413,8 +418,12 @@ int main (int argc, const char *argv[])
     check();
   else if (action_str == "pipe")
     pipe();
+  else if (action_str == "batch")
+    batch();
   else if (action_str == "list")
     list();
+  else if (action_str == "stats")
+    stats();
   else if (action_str == "conv")
     convt();
   else if (action_str == "norm")
@@ -697,6 +706,267 @@ void print_elements(const AspellWordList * wl) {
     print_error(aspell_speller_error_message(speller)); break;\
   } } while (false)
 
+///////////////////////////
+//
+// parallel checking
+//
+
+// Used when more than one thread is wanted.  The words are found by a
+// single checker, so that any filter state is kept, and then checked
+// by several threads at once, each with its own speller context.
+// Each thread prints the results for the words it checked to its own
+// buffer and the buffers are written out in order, so the output is
+// the same as when the words are checked one at a time.
+
+struct CheckedWord {
+  const char * begin; // the word in the input
+  const char * end;
+  unsigned word;      // the word in the internal encoding, in word_buf
+  unsigned size;
+  bool correct;
+};
+
+class CheckJob : public ParallelJob {
+public:
+  SpellerContext * context;
+  char * word_buf;
+  CheckedWord * begin;
+  CheckedWord * end;
+  String out;
+  PosibErrBase err;
+  CheckJob() : context(0) {}
+  ~CheckJob() {delete context;}
+  void run();
+  // print the results for a word to "out"
+  virtual void print(const CheckedWord &) = 0;
+};
+
+void CheckJob::run()
+{
+  out.clear();
+  for (CheckedWord * w = begin; w != end; ++w) {
+    PosibErr<bool> res 
+      = context->check(MutableString(word_buf + w->word, w->size));
+    if (res.has_err()) {err = res; return;}
+    w->correct = res.data;
+    print(*w);
+  }
+}
+
+static const unsigned check_block_size = 1024*1024;
+
+class ParallelChecker {
+  ParallelChecker(const ParallelChecker &);
+  void operator= (const ParallelChecker &);
+  Speller * speller;
+  Vector<CheckJob *> jobs; // one for each thread
+  Vector<ParallelJob *> job_ptrs;
+  Vector<CheckedWord> words;
+  CharVector word_buf;
+public:
+  const char * block;         // the block being checked by check_stream
+  unsigned long block_offset; // and its offset in the input
+  ParallelChecker(AspellSpeller * sp) 
+    : speller(reinterpret_cast<Speller *>(sp)), block(0), block_offset(0) {}
+  ~ParallelChecker();
+  // takes ownership of the job
+  void add_job(CheckJob *);
+  // should be called after any options are changed
+  void new_contexts();
+  // gets the words from a checker which must not be checking the
+  // words itself, the "which" pointer of each string processed must
+  // be the string itself
+  void find_words(Checker *);
+  // checks the words found and prints the results
+  void check_words();
+  // checks everything in "in", which is read in large blocks ending
+  // on a line boundary
+  void check_stream(Checker *, FILE * in);
+};
+
+ParallelChecker::~ParallelChecker()
+{
+  for (Vector<CheckJob *>::iterator i = jobs.begin(); i != jobs.end(); ++i)
+    delete *i;
+}
+
+void ParallelChecker::add_job(CheckJob * j)
+{
+  jobs.push_back(j);
+  job_ptrs.push_back(j);
+  EXIT_ON_ERR_SET(new_speller_context(speller), SpellerContext *, c);
+  j->context = c;
+}
+
+void ParallelChecker::new_contexts()
+{
+  for (Vector<CheckJob *>::iterator i = jobs.begin(); i != jobs.end(); ++i) {
+    delete (*i)->context;
+    (*i)->context = 0;
+    EXIT_ON_ERR_SET(new_speller_context(speller), SpellerContext *, c);
+    (*i)->context = c;
+  }
+}
+
+void ParallelChecker::find_words(Checker * checker)
+{
+  const CheckerToken * tok;
+  while ((tok = checker->next()) != 0) {
+    CheckedWord w;
+    w.begin = static_cast<const char *>(tok->begin.which) + tok->begin.offset;
+    w.end = w.begin + (tok->end.offset - tok->begin.offset);
+    w.word = word_buf.size();
+    w.size = strlen(checker->cur_word());
+    w.correct = false;
+    word_buf.append(checker->cur_word(), w.size + 1);
+    words.push_back(w);
+  }
+}
+
+void ParallelChecker::check_words()
+{
+  if (words.empty()) return;
+  unsigned num_jobs = jobs.size() < words.size() ? jobs.size() : words.size();
+  CheckedWord * w = words.pbegin();
+  for (unsigned i = 0; i != num_jobs; ++i) {
+    CheckJob * j = jobs[i];
+    j->word_buf = word_buf.data();
+    j->begin = w;
+    w += (words.pend() - w) / (num_jobs - i);
+    j->end = w;
+  }
+  run_parallel(job_ptrs.pbegin(), num_jobs, num_jobs);
+  for (unsigned i = 0; i != num_jobs; ++i) {
+    if (jobs[i]->err.has_err()) {
+      print_error(jobs[i]->err.get_err()->mesg);
+      exit(1);
+    }
+  }
+  for (unsigned i = 0; i != num_jobs; ++i)
+    COUT.write(jobs[i]->out);
+  words.clear();
+  word_buf.clear();
+}
+
+void ParallelChecker::check_stream(Checker * checker, FILE * in)
+{
+  CharVector buf;
+  bool eof = false;
+  block_offset = 0;
+  while (!eof) {
+    unsigned prev_size = buf.size();
+    buf.resize(prev_size + check_block_size);
+    size_t n = fread(buf.data() + prev_size, 1, check_block_size, in);
+    buf.resize(prev_size + n);
+    if (n == 0) eof = true;
+    unsigned size = buf.size();
+    if (!eof) {
+      while (size > prev_size && buf[size - 1] != '\n') --size;
+      if (size == prev_size) continue; // no complete line yet
+    }
+    if (size == 0) continue;
+    block = buf.data();
+    // pass in one line at a time, just as CheckerString does
+    const char * line = buf.data();
+    const char * block_end = buf.data() + size;
+    while (line != block_end) {
+      const char * line_end = static_cast<const char *>
+        (memchr(line, '\n', block_end - line));
+      line_end = line_end ? line_end + 1 : block_end;
+      checker->process(line, line_end - line, 0, 
+                       const_cast<char *>(line));
+      find_words(checker);
+      line = line_end;
+    }
+    check_words();
+    block_offset += size;
+    buf.erase(buf.begin(), buf.begin() + size);
+  }
+}
+
+// used by pipe
+struct PipeParms {
+  const char * line0;
+  bool terse_mode;
+  bool suggest;
+  bool include_guesses;
+  bool do_time;
+  bool reverse;
+  MBLen * mb_len;
+};
+
+class PipeJob : public CheckJob {
+public:
+  const PipeParms * parms;
+  String word;
+  String guesses;
+  PipeJob(const PipeParms * p) : parms(p) {}
+  void print(const CheckedWord &);
+};
+
+void PipeJob::print(const CheckedWord & w)
+{
+  AspellSpellerContext * ctx 
+    = reinterpret_cast<AspellSpellerContext *>(context);
+  if (w.correct) {
+    if (!parms->terse_mode) {
+      const AspellCheckInfo * ci = aspell_speller_context_check_info(ctx);
+      out << ci->str << '\n';
+    }
+    return;
+  }
+  word.assign(w.begin, w.end - w.begin);
+  guesses.clear();
+  const AspellCheckInfo * ci = aspell_speller_context_check_info(ctx);
+  while (ci) {
+    guesses << ", " << ci->str;
+    ci = ci->next;
+  }
+  clock_t start = clock();
+  const AspellWordList * suggestions = 0;
+  if (parms->suggest) 
+    suggestions = aspell_speller_context_suggest(ctx, word.str(), -1);
+  clock_t finish = clock();
+  unsigned offset = (*parms->mb_len)(parms->line0, w.begin - parms->line0);
+  if (suggestions && !aspell_word_list_empty(suggestions)) 
+  {
+    out.printf("& %s %u %u:", word.str(), 
+               aspell_word_list_size(suggestions), offset);
+    AspellStringEnumeration * els = aspell_word_list_elements(suggestions);
+    const char * s;
+    if (parms->reverse) {
+      Vector<String> sugs;
+      sugs.reserve(aspell_word_list_size(suggestions));
+      while ( ( s = aspell_string_enumeration_next(els)) != 0)
+        sugs.push_back(s);
+      Vector<String>::reverse_iterator i = sugs.rbegin();
+      while (true) {
+        out.printf(" %s", i->c_str());
+        ++i;
+        if (i == sugs.rend()) break;
+        out << ',';
+      }
+    } else {
+      while ( ( s = aspell_string_enumeration_next(els)) != 0) {
+        out.printf(" %s%s", s, 
+                   aspell_string_enumeration_at_end(els) ? "" : ",");
+      }
+    }
+    delete_aspell_string_enumeration(els);
+    if (parms->include_guesses)
+      out << guesses;
+    out << '\n';
+  } else {
+    if (guesses.empty())
+      out.printf("# %s %u\n", word.str(), offset);
+    else
+      out.printf("? %s 0 %u: %s\n", word.str(), offset, guesses.c_str() + 2);
+  }
+  if (parms->do_time)
+    out.printf(_("Suggestion Time: %f\n"), 
+               (finish-start)/(double)CLOCKS_PER_SEC);
+}
+
 void pipe() 
 {
   line_buffer();
@@ -736,6 +1006,20 @@ void pipe()
   int    ignore;
   PosibErrBase err;
 
+  // the words of each line are checked by several threads if
+  // requested, input is never read ahead
+  unsigned jobs = options->retrieve_int("jobs");
+  StackPtr<ParallelChecker> parallel;
+  PipeParms parms;
+  parms.mb_len = &mb_len;
+  if (jobs != 1) {
+    if (jobs == 0) jobs = num_processors();
+    parallel.reset(new ParallelChecker(speller));
+    for (unsigned i = 0; i != jobs; ++i)
+      parallel->add_job(new PipeJob(&parms));
+    reinterpret_cast<Checker *>(checker)->set_check_words(false);
+  }
+
   print_ver();
 
   for (;;) {
@@ -807,6 +1091,7 @@ void pipe()
           case 's':
             if (get_word_pair(line + 4, word, word2))
               BREAK_ON_ERR(err = config->replace(word, word2));
+            if (parallel) parallel->new_contexts();
             if (strcmp(word,"suggest") == 0)
               suggest = config->retrieve_bool("suggest");
             else if (strcmp(word,"time") == 0)
@@ -844,6 +1129,19 @@ void pipe()
     default:
       line0 = line;
       line += ignore;
+      if (parallel) {
+        parms.line0 = line0;
+        parms.terse_mode = terse_mode;
+        parms.suggest = suggest;
+        parms.include_guesses = include_guesses;
+        parms.do_time = do_time;
+        parms.reverse = options->retrieve_bool("reverse");
+        aspell_checker_process(checker, line, strlen(line), 0, line);
+        parallel->find_words(reinterpret_cast<Checker *>(checker));
+        parallel->check_words();
+        COUT.put('\n');
+        break;
+      }
       aspell_checker_process(checker, line, strlen(line), 0, 0);
       const AspellCheckerToken * token = 0;
       while (token = aspell_checker_next(checker), token) {
@@ -917,9 +1215,92 @@ void pipe()
     BREAK_ON_ERR(reload_filters(real_speller));
     delete_aspell_checker(checker); // FIXME: Why?
     checker = new_checker(speller);
+    if (parallel) {
+      parallel->new_contexts();
+      reinterpret_cast<Checker *>(checker)->set_check_words(false);
+    }
     continue;
   }
 
+  parallel.del();
+  delete_aspell_checker(checker);
+  delete_aspell_speller(speller);
+}
+
+///////////////////////////
+//
+// batch
+//
+
+class BatchJob : public CheckJob {
+public:
+  const ParallelChecker * parent;
+  bool json;
+  void print(const CheckedWord & w);
+};
+
+static void json_escape(String & out, const char * str, const char * end)
+{
+  for (; str != end; ++str) {
+    unsigned char c = *str;
+    if (c == '"' || c == '\\') {
+      out << '\\' << *str;
+    } else if (c < 0x20) {
+      out.printf("\\u%04x", c);
+    } else {
+      out << *str;
+    }
+  }
+}
+
+void BatchJob::print(const CheckedWord & w)
+{
+  if (w.correct) return;
+  unsigned long offset = parent->block_offset + (w.begin - parent->block);
+  if (json) {
+    out.printf("{\"offset\":%lu,\"length\":%u,\"word\":\"", 
+               offset, (unsigned)(w.end - w.begin));
+    json_escape(out, w.begin, w.end);
+    out << "\"}\n";
+  } else {
+    out.printf("%lu\t%u\t", offset, (unsigned)(w.end - w.begin));
+    out.append(w.begin, w.end - w.begin);
+    out << '\n';
+  }
+}
+
+void batch()
+{
+  bool json = false;
+  if (!args.empty()) {
+    if (args[0] == "json") {
+      json = true;
+    } else if (args[0] != "tsv") {
+      print_error(_("\"%s\" is not a valid batch format."), args[0]);
+      exit(1);
+    }
+  }
+
+  // unlike the other commands batch uses all processors by default
+  unsigned threads = 0;
+  if (options->have("jobs")) threads = options->retrieve_int("jobs");
+  if (threads == 0) threads = num_processors();
+
+  AspellSpeller * speller = new_speller();
+  AspellChecker * checker = new_checker(speller);
+  reinterpret_cast<Checker *>(checker)->set_check_words(false);
+
+  {
+    ParallelChecker parallel(speller);
+    for (unsigned i = 0; i != threads; ++i) {
+      BatchJob * j = new BatchJob;
+      j->parent = &parallel;
+      j->json = json;
+      parallel.add_job(j);
+    }
+    parallel.check_stream(reinterpret_cast<Checker *>(checker), stdin);
+  }
+
   delete_aspell_checker(checker);
   delete_aspell_speller(speller);
 }
@@ -1256,11 +1637,35 @@ void Mapping::to_ispell()
 // list
 //
 
+class ListJob : public CheckJob {
+public:
+  void print(const CheckedWord & w) {
+    if (w.correct) return;
+    out.append(w.begin, w.end - w.begin);
+    out << '\n';
+  }
+};
+
 void list()
 {
   AspellSpeller * speller = new_speller();
   AspellChecker * checker = new_checker(speller);
 
+  unsigned jobs = options->retrieve_int("jobs");
+  if (jobs != 1) {
+    if (jobs == 0) jobs = num_processors();
+    reinterpret_cast<Checker *>(checker)->set_check_words(false);
+    {
+      ParallelChecker parallel(speller);
+      for (unsigned i = 0; i != jobs; ++i)
+        parallel.add_job(new ListJob);
+      parallel.check_stream(reinterpret_cast<Checker *>(checker), stdin);
+    }
+    delete_aspell_checker(checker);
+    delete_aspell_speller(speller);
+    return;
+  }
+
   state = new CheckerString(checker, speller,stdin,0,64);
 
   String word;
@@ -1276,6 +1681,70 @@ void list()
   delete_aspell_speller(speller);
 }
 
+///////////////////////////
+//
+// stats
+//
+
+void stats()
+{
+  options->replace("collect-stats", "true");
+
+  AspellSpeller * speller = new_speller();
+  AspellChecker * checker = new_checker(speller);
+
+  state = new CheckerString(checker, speller,stdin,0,64);
+
+  String word;
+  unsigned long misspelled = 0;
+  while (state->next_misspelling()) {
+    state->get_real_word(word);
+    const AspellWordList * suggestions
+      = aspell_speller_suggest(speller, word.str(), word.size());
+    // go through the suggestions as if they were printed so that they
+    // are converted, and counted, the same way
+    AspellStringEnumeration * els = aspell_word_list_elements(suggestions);
+    while (aspell_string_enumeration_next(els) != 0)
+      ;
+    delete_aspell_string_enumeration(els);
+    ++misspelled;
+  }
+
+  const AspellSpellerStats * st = aspell_speller_stats(speller);
+
+  static const char * stage_names[AspellStageCount] = {
+    "split", "repl", "one-edit-word", "scan-1", "scan-2",
+    "ngram", "score-list", "fine-tune-score"
+  };
+
+  COUT.printf("checks               %lu\n", st->checks);
+  COUT.printf("misspelled           %lu\n", misspelled);
+  COUT.printf("check probes         %lu\n", st->check_probes);
+  COUT.printf("probes per check     %.2f\n",
+              st->checks ? st->check_probes/(double)st->checks : 0.0);
+  COUT.printf("suggests             %lu\n", st->suggests);
+  COUT.printf("suggest probes       %lu\n", st->suggest_probes);
+  COUT.printf("probes per suggest   %.2f\n",
+              st->suggests ? st->suggest_probes/(double)st->suggests : 0.0);
+  COUT.printf("suggest cache hits   %u\n", aspell_speller_suggest_cache_hits(speller));
+  COUT.printf("suggest cache misses %u\n", aspell_speller_suggest_cache_misses(speller));
+  COUT.printf("affix cache hits     %u\n", aspell_speller_affix_cache_hits(speller));
+  COUT.printf("affix cache misses   %u\n", aspell_speller_affix_cache_misses(speller));
+  COUT.printf("affix candidates     %lu\n", st->affix_candidates);
+  COUT.printf("bytes to internal    %lu\n", st->bytes_to_internal);
+  COUT.printf("bytes from internal  %lu\n", st->bytes_from_internal);
+  COUT.printf("\n%-16s %8s %12s %12s\n", "stage", "calls", "total ms", "ms per call");
+  for (int i = 0; i != AspellStageCount; ++i) {
+    if (st->stage_calls[i] == 0) continue;
+    COUT.printf("%-16s %8lu %12.3f %12.4f\n", stage_names[i], st->stage_calls[i],
+                st->stage_time[i] * 1000,
+                st->stage_time[i] * 1000 / st->stage_calls[i]);
+  }
+
+  state.del(); // to close the file handles
+  delete_aspell_speller(speller);
+}
+
 ///////////////////////////
 //
 // convt
@@ -1911,6 +2380,8 @@ static const char * help_text[] =
   usage_text[4],
   usage_text[5],
   N_("  list             produce a list of misspelled words from standard input"),
+  N_("  batch [tsv|json] list misspelled words and their offsets using many threads"),
+  N_("  stats            checks standard input and reports what the speller did"),
   usage_text[6],
   usage_text[7],
   N_("  soundslike       returns the sounds like equivalent for each word entered"),